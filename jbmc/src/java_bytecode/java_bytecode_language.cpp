@@ -104,6 +104,8 @@ void parse_java_language_options(const cmdlinet &cmd, optionst &options)
     options.set_option(
       "java-cp-include-files", cmd.get_value("java-cp-include-files"));
   }
+  if(cmd.isset("java-class-cache"))
+    options.set_option("java-class-cache", cmd.get_value("java-class-cache"));
   if(cmd.isset("static-values"))
   {
     options.set_option("static-values", cmd.get_value("static-values"));
@@ -225,6 +227,9 @@ java_bytecode_language_optionst::java_bytecode_language_optionst(
   else
     java_cp_include_files=".*";
 
+  if(options.is_set("java-class-cache"))
+    java_class_cache = options.get_option("java-class-cache");
+
   nondet_static = options.get_bool_option("nondet-static");
   if(options.is_set("static-values"))
   {
@@ -304,6 +309,8 @@ void java_bytecode_languaget::initialize_class_loader()
 
   java_class_loader.set_java_cp_include_files(
     language_options->java_cp_include_files);
+  if(language_options->java_class_cache.has_value())
+    java_class_loader.set_class_cache(*language_options->java_class_cache);
   java_class_loader.add_load_classes(language_options->java_load_classes);
   if(language_options->string_refinement_enabled)
   {
@@ -42,6 +42,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(max-nondet-tree-depth):" \
   "(java-max-vla-length):" \
   "(java-cp-include-files):" \
+  "(java-class-cache):" \
   "(ignore-manifest-main-class)" \
   "(context-include):" \
   "(context-exclude):" \
@@ -80,6 +81,8 @@ Author: Daniel Kroening, kroening@kroening.com
   " --java-max-vla-length N      limit the length of user-code-created arrays\n" /* NOLINT(*) */ \
   " --java-cp-include-files r    regexp or JSON list of files to load\n" \
   "                              (with '@' prefix)\n" \
+  " --java-class-cache dir       keep parsed classes loaded from JAR files in\n" /* NOLINT(*) */ \
+  "                              directory dir and reuse them in later runs\n" /* NOLINT(*) */ \
   " --ignore-manifest-main-class ignore Main-Class entries in JAR manifest files.\n" /* NOLINT(*) */ \
   "                              If this option is specified and the options\n" /* NOLINT(*) */ \
   "                              --function and --main-class are not, we can be\n" /* NOLINT(*) */ \
@@ -241,6 +244,8 @@ struct java_bytecode_language_optionst
   /// list of classes to force load even without reference from the entry point
   std::vector<irep_idt> java_load_classes;
   std::string java_cp_include_files;
+  /// Directory of the persistent cache of parsed classes, if enabled
+  optionalt<std::string> java_class_cache;
   /// JSON which contains initial values of static fields (right
   /// after the static initializer of the class was run). This is read from the
   /// file specified by the --static-values command-line option.
@@ -0,0 +1,584 @@
+/*******************************************************************\
+
+Module: On-disk cache of parsed Java class files
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// On-disk cache of parsed Java class files
+
+#include "java_class_cache.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include <util/exception_utils.h>
+#include <util/file_util.h>
+#include <util/irep_serialization.h>
+#include <util/message.h>
+#include <util/string_hash.h>
+
+/// Magic bytes at the start of each cache entry
+static const char cache_magic[] = {'J', 'C', 'C'};
+
+static void write_optional_string(
+  std::ostream &out,
+  const optionalt<std::string> &value)
+{
+  write_gb_word(out, value.has_value() ? 1 : 0);
+  if(value.has_value())
+    write_gb_string(out, *value);
+}
+
+static optionalt<std::string>
+read_optional_string(std::istream &in, irep_serializationt &converter)
+{
+  if(irep_serializationt::read_gb_word(in) == 0)
+    return {};
+  return id2string(converter.read_gb_string(in));
+}
+
+static void write_annotations(
+  std::ostream &out,
+  const java_bytecode_parse_treet::annotationst &annotations,
+  irep_serializationt &converter)
+{
+  write_gb_word(out, annotations.size());
+  for(const auto &annotation : annotations)
+  {
+    converter.reference_convert(annotation.type, out);
+    write_gb_word(out, annotation.element_value_pairs.size());
+    for(const auto &pair : annotation.element_value_pairs)
+    {
+      converter.write_string_ref(out, pair.element_name);
+      converter.reference_convert(pair.value, out);
+    }
+  }
+}
+
+static void read_annotations(
+  std::istream &in,
+  java_bytecode_parse_treet::annotationst &annotations,
+  irep_serializationt &converter)
+{
+  annotations.resize(irep_serializationt::read_gb_word(in));
+  for(auto &annotation : annotations)
+  {
+    annotation.type =
+      static_cast<const typet &>(converter.reference_convert(in));
+    annotation.element_value_pairs.resize(
+      irep_serializationt::read_gb_word(in));
+    for(auto &pair : annotation.element_value_pairs)
+    {
+      pair.element_name = converter.read_string_ref(in);
+      pair.value = static_cast<const exprt &>(converter.reference_convert(in));
+    }
+  }
+}
+
+static void write_member(
+  std::ostream &out,
+  const java_bytecode_parse_treet::membert &member,
+  irep_serializationt &converter)
+{
+  write_gb_string(out, member.descriptor);
+  write_optional_string(out, member.signature);
+  converter.write_string_ref(out, member.name);
+
+  unsigned flags = 0;
+  flags = (flags << 1) | static_cast<unsigned>(member.is_public);
+  flags = (flags << 1) | static_cast<unsigned>(member.is_protected);
+  flags = (flags << 1) | static_cast<unsigned>(member.is_private);
+  flags = (flags << 1) | static_cast<unsigned>(member.is_static);
+  flags = (flags << 1) | static_cast<unsigned>(member.is_final);
+  write_gb_word(out, flags);
+
+  write_annotations(out, member.annotations, converter);
+}
+
+static void read_member(
+  std::istream &in,
+  java_bytecode_parse_treet::membert &member,
+  irep_serializationt &converter)
+{
+  member.descriptor = id2string(converter.read_gb_string(in));
+  member.signature = read_optional_string(in, converter);
+  member.name = converter.read_string_ref(in);
+
+  const std::size_t flags = irep_serializationt::read_gb_word(in);
+  member.is_public = (flags & (1 << 4)) != 0;
+  member.is_protected = (flags & (1 << 3)) != 0;
+  member.is_private = (flags & (1 << 2)) != 0;
+  member.is_static = (flags & (1 << 1)) != 0;
+  member.is_final = (flags & 1) != 0;
+
+  read_annotations(in, member.annotations, converter);
+}
+
+static void write_verification_type_infos(
+  std::ostream &out,
+  const std::vector<
+    java_bytecode_parse_treet::methodt::verification_type_infot> &infos)
+{
+  write_gb_word(out, infos.size());
+  for(const auto &info : infos)
+  {
+    write_gb_word(out, info.type);
+    write_gb_word(out, info.tag);
+    write_gb_word(out, info.cpool_index);
+    write_gb_word(out, info.offset);
+  }
+}
+
+static void read_verification_type_infos(
+  std::istream &in,
+  std::vector<java_bytecode_parse_treet::methodt::verification_type_infot>
+    &infos)
+{
+  using infot = java_bytecode_parse_treet::methodt::verification_type_infot;
+
+  infos.resize(irep_serializationt::read_gb_word(in));
+  for(auto &info : infos)
+  {
+    info.type = static_cast<infot::verification_type_info_type>(
+      irep_serializationt::read_gb_word(in));
+    info.tag = static_cast<u1>(irep_serializationt::read_gb_word(in));
+    info.cpool_index = static_cast<u2>(irep_serializationt::read_gb_word(in));
+    info.offset = static_cast<u2>(irep_serializationt::read_gb_word(in));
+  }
+}
+
+static void write_method(
+  std::ostream &out,
+  const java_bytecode_parse_treet::methodt &method,
+  irep_serializationt &converter)
+{
+  write_member(out, method, converter);
+  converter.write_string_ref(out, method.base_name);
+
+  unsigned flags = 0;
+  flags = (flags << 1) | static_cast<unsigned>(method.is_native);
+  flags = (flags << 1) | static_cast<unsigned>(method.is_abstract);
+  flags = (flags << 1) | static_cast<unsigned>(method.is_synchronized);
+  flags = (flags << 1) | static_cast<unsigned>(method.is_bridge);
+  flags = (flags << 1) | static_cast<unsigned>(method.is_varargs);
+  flags = (flags << 1) | static_cast<unsigned>(method.is_synthetic);
+  write_gb_word(out, flags);
+
+  converter.reference_convert(method.source_location, out);
+
+  write_gb_word(out, method.instructions.size());
+  for(const auto &instruction : method.instructions)
+  {
+    converter.reference_convert(instruction.source_location, out);
+    write_gb_word(out, instruction.address);
+    write_gb_word(out, instruction.bytecode);
+    write_gb_word(out, instruction.args.size());
+    for(const auto &arg : instruction.args)
+      converter.reference_convert(arg, out);
+  }
+
+  write_gb_word(out, method.parameter_annotations.size());
+  for(const auto &annotations : method.parameter_annotations)
+    write_annotations(out, annotations, converter);
+
+  write_gb_word(out, method.exception_table.size());
+  for(const auto &entry : method.exception_table)
+  {
+    write_gb_word(out, entry.start_pc);
+    write_gb_word(out, entry.end_pc);
+    write_gb_word(out, entry.handler_pc);
+    converter.reference_convert(entry.catch_type, out);
+  }
+
+  write_gb_word(out, method.throws_exception_table.size());
+  for(const auto &exception : method.throws_exception_table)
+    converter.write_string_ref(out, exception);
+
+  write_gb_word(out, method.local_variable_table.size());
+  for(const auto &variable : method.local_variable_table)
+  {
+    converter.write_string_ref(out, variable.name);
+    write_gb_string(out, variable.descriptor);
+    write_optional_string(out, variable.signature);
+    write_gb_word(out, variable.index);
+    write_gb_word(out, variable.start_pc);
+    write_gb_word(out, variable.length);
+  }
+
+  write_gb_word(out, method.stack_map_table.size());
+  for(const auto &entry : method.stack_map_table)
+  {
+    write_gb_word(out, entry.type);
+    write_gb_word(out, entry.offset_delta);
+    write_gb_word(out, entry.chops);
+    write_gb_word(out, entry.appends);
+    write_verification_type_infos(out, entry.locals);
+    write_verification_type_infos(out, entry.stack);
+  }
+}
+
+static void read_method(
+  std::istream &in,
+  java_bytecode_parse_treet::methodt &method,
+  irep_serializationt &converter)
+{
+  using methodt = java_bytecode_parse_treet::methodt;
+
+  read_member(in, method, converter);
+  method.base_name = converter.read_string_ref(in);
+
+  const std::size_t flags = irep_serializationt::read_gb_word(in);
+  method.is_native = (flags & (1 << 5)) != 0;
+  method.is_abstract = (flags & (1 << 4)) != 0;
+  method.is_synchronized = (flags & (1 << 3)) != 0;
+  method.is_bridge = (flags & (1 << 2)) != 0;
+  method.is_varargs = (flags & (1 << 1)) != 0;
+  method.is_synthetic = (flags & 1) != 0;
+
+  method.source_location =
+    static_cast<const source_locationt &>(converter.reference_convert(in));
+
+  method.instructions.resize(irep_serializationt::read_gb_word(in));
+  for(auto &instruction : method.instructions)
+  {
+    instruction.source_location =
+      static_cast<const source_locationt &>(converter.reference_convert(in));
+    instruction.address =
+      static_cast<unsigned>(irep_serializationt::read_gb_word(in));
+    instruction.bytecode = irep_serializationt::read_gb_word(in);
+    instruction.args.resize(irep_serializationt::read_gb_word(in));
+    for(auto &arg : instruction.args)
+      arg = static_cast<const exprt &>(converter.reference_convert(in));
+  }
+
+  method.parameter_annotations.resize(irep_serializationt::read_gb_word(in));
+  for(auto &annotations : method.parameter_annotations)
+    read_annotations(in, annotations, converter);
+
+  method.exception_table.resize(irep_serializationt::read_gb_word(in));
+  for(auto &entry : method.exception_table)
+  {
+    entry.start_pc = irep_serializationt::read_gb_word(in);
+    entry.end_pc = irep_serializationt::read_gb_word(in);
+    entry.handler_pc = irep_serializationt::read_gb_word(in);
+    entry.catch_type =
+      static_cast<const struct_tag_typet &>(converter.reference_convert(in));
+  }
+
+  method.throws_exception_table.resize(irep_serializationt::read_gb_word(in));
+  for(auto &exception : method.throws_exception_table)
+    exception = converter.read_string_ref(in);
+
+  method.local_variable_table.resize(irep_serializationt::read_gb_word(in));
+  for(auto &variable : method.local_variable_table)
+  {
+    variable.name = converter.read_string_ref(in);
+    variable.descriptor = id2string(converter.read_gb_string(in));
+    variable.signature = read_optional_string(in, converter);
+    variable.index = irep_serializationt::read_gb_word(in);
+    variable.start_pc = irep_serializationt::read_gb_word(in);
+    variable.length = irep_serializationt::read_gb_word(in);
+  }
+
+  method.stack_map_table.resize(irep_serializationt::read_gb_word(in));
+  for(auto &entry : method.stack_map_table)
+  {
+    entry.type = static_cast<methodt::stack_map_table_entryt::stack_frame_type>(
+      irep_serializationt::read_gb_word(in));
+    entry.offset_delta = irep_serializationt::read_gb_word(in);
+    entry.chops = irep_serializationt::read_gb_word(in);
+    entry.appends = irep_serializationt::read_gb_word(in);
+    read_verification_type_infos(in, entry.locals);
+    read_verification_type_infos(in, entry.stack);
+  }
+}
+
+static void write_class(
+  std::ostream &out,
+  const java_bytecode_parse_treet::classt &parsed_class,
+  irep_serializationt &converter)
+{
+  converter.write_string_ref(out, parsed_class.name);
+  converter.write_string_ref(out, parsed_class.super_class);
+  converter.write_string_ref(out, parsed_class.inner_name);
+  converter.write_string_ref(out, parsed_class.outer_class);
+
+  unsigned flags = 0;
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_abstract);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_enum);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_public);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_protected);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_private);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_final);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_interface);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_synthetic);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_annotation);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_inner_class);
+  flags = (flags << 1) | static_cast<unsigned>(parsed_class.is_static_class);
+  flags =
+    (flags << 1) | static_cast<unsigned>(parsed_class.is_anonymous_class);
+  flags = (flags << 1) |
+          static_cast<unsigned>(parsed_class.attribute_bootstrapmethods_read);
+  write_gb_word(out, flags);
+
+  write_gb_word(out, parsed_class.enum_elements);
+
+  write_gb_word(out, parsed_class.lambda_method_handle_map.size());
+  for(const auto &entry : parsed_class.lambda_method_handle_map)
+  {
+    converter.write_string_ref(out, entry.first.first);
+    write_gb_word(out, entry.first.second);
+    write_gb_word(out, static_cast<std::size_t>(entry.second.handle_type));
+    write_gb_word(out, entry.second.method_descriptor.has_value() ? 1 : 0);
+    if(entry.second.method_descriptor.has_value())
+      converter.reference_convert(*entry.second.method_descriptor, out);
+  }
+
+  write_gb_word(out, parsed_class.implements.size());
+  for(const auto &interface : parsed_class.implements)
+    converter.write_string_ref(out, interface);
+
+  write_optional_string(out, parsed_class.signature);
+
+  write_gb_word(out, parsed_class.fields.size());
+  for(const auto &field : parsed_class.fields)
+  {
+    write_member(out, field, converter);
+    write_gb_word(out, field.is_enum ? 1 : 0);
+  }
+
+  write_gb_word(out, parsed_class.methods.size());
+  for(const auto &method : parsed_class.methods)
+    write_method(out, method, converter);
+
+  write_annotations(out, parsed_class.annotations, converter);
+}
+
+static void read_class(
+  std::istream &in,
+  java_bytecode_parse_treet::classt &parsed_class,
+  irep_serializationt &converter)
+{
+  using classt = java_bytecode_parse_treet::classt;
+
+  parsed_class.name = converter.read_string_ref(in);
+  parsed_class.super_class = converter.read_string_ref(in);
+  parsed_class.inner_name = converter.read_string_ref(in);
+  parsed_class.outer_class = converter.read_string_ref(in);
+
+  const std::size_t flags = irep_serializationt::read_gb_word(in);
+  parsed_class.is_abstract = (flags & (1 << 12)) != 0;
+  parsed_class.is_enum = (flags & (1 << 11)) != 0;
+  parsed_class.is_public = (flags & (1 << 10)) != 0;
+  parsed_class.is_protected = (flags & (1 << 9)) != 0;
+  parsed_class.is_private = (flags & (1 << 8)) != 0;
+  parsed_class.is_final = (flags & (1 << 7)) != 0;
+  parsed_class.is_interface = (flags & (1 << 6)) != 0;
+  parsed_class.is_synthetic = (flags & (1 << 5)) != 0;
+  parsed_class.is_annotation = (flags & (1 << 4)) != 0;
+  parsed_class.is_inner_class = (flags & (1 << 3)) != 0;
+  parsed_class.is_static_class = (flags & (1 << 2)) != 0;
+  parsed_class.is_anonymous_class = (flags & (1 << 1)) != 0;
+  parsed_class.attribute_bootstrapmethods_read = (flags & 1) != 0;
+
+  parsed_class.enum_elements = irep_serializationt::read_gb_word(in);
+
+  const std::size_t handle_count = irep_serializationt::read_gb_word(in);
+  for(std::size_t i = 0; i < handle_count; ++i)
+  {
+    const irep_idt class_name = converter.read_string_ref(in);
+    const std::size_t bootstrap_index = irep_serializationt::read_gb_word(in);
+    classt::lambda_method_handlet handle;
+    handle.handle_type = static_cast<java_class_typet::method_handle_kindt>(
+      irep_serializationt::read_gb_word(in));
+    if(irep_serializationt::read_gb_word(in) != 0)
+    {
+      handle.method_descriptor =
+        static_cast<const class_method_descriptor_exprt &>(
+          converter.reference_convert(in));
+    }
+    parsed_class.lambda_method_handle_map.emplace(
+      std::make_pair(class_name, bootstrap_index), std::move(handle));
+  }
+
+  const std::size_t implements_count = irep_serializationt::read_gb_word(in);
+  for(std::size_t i = 0; i < implements_count; ++i)
+    parsed_class.implements.push_back(converter.read_string_ref(in));
+
+  parsed_class.signature = read_optional_string(in, converter);
+
+  const std::size_t field_count = irep_serializationt::read_gb_word(in);
+  for(std::size_t i = 0; i < field_count; ++i)
+  {
+    auto &field = parsed_class.add_field();
+    read_member(in, field, converter);
+    field.is_enum = irep_serializationt::read_gb_word(in) != 0;
+  }
+
+  const std::size_t method_count = irep_serializationt::read_gb_word(in);
+  for(std::size_t i = 0; i < method_count; ++i)
+    read_method(in, parsed_class.add_method(), converter);
+
+  read_annotations(in, parsed_class.annotations, converter);
+}
+
+void write_java_class_cache_entry(
+  std::ostream &out,
+  const java_bytecode_parse_treet &parse_tree)
+{
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt converter(ireps_container);
+
+  out.write(cache_magic, sizeof(cache_magic));
+  write_gb_word(out, JAVA_CLASS_CACHE_VERSION);
+
+  write_class(out, parse_tree.parsed_class, converter);
+
+  write_gb_word(out, parse_tree.class_refs.size());
+  for(const auto &class_ref : parse_tree.class_refs)
+    converter.write_string_ref(out, class_ref);
+
+  write_gb_word(out, parse_tree.loading_successful ? 1 : 0);
+}
+
+optionalt<java_bytecode_parse_treet>
+read_java_class_cache_entry(std::istream &in)
+{
+  char magic[sizeof(cache_magic)];
+  in.read(magic, sizeof(magic));
+  if(!in || !std::equal(magic, magic + sizeof(magic), cache_magic))
+    return {};
+
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt converter(ireps_container);
+
+  java_bytecode_parse_treet parse_tree;
+
+  // a truncated entry, e.g. one left behind by a crashed writer, makes the
+  // reader run out of input
+  try
+  {
+    if(irep_serializationt::read_gb_word(in) != JAVA_CLASS_CACHE_VERSION)
+      return {};
+
+    read_class(in, parse_tree.parsed_class, converter);
+
+    const std::size_t class_ref_count = irep_serializationt::read_gb_word(in);
+    for(std::size_t i = 0; i < class_ref_count; ++i)
+      parse_tree.class_refs.insert(converter.read_string_ref(in));
+
+    parse_tree.loading_successful = irep_serializationt::read_gb_word(in) != 0;
+  }
+  catch(const deserialization_exceptiont &)
+  {
+    return {};
+  }
+
+  return std::move(parse_tree);
+}
+
+/// Compute the name of the cache subdirectory for \p jar_path from a hash of
+/// the file contents, its size and the cache format version.
+const std::string &java_class_cachet::jar_directory(const std::string &jar_path)
+{
+  auto entry = jar_directories.emplace(jar_path, std::string());
+  if(!entry.second)
+    return entry.first->second;
+
+  std::ifstream jar(jar_path, std::ios::binary);
+  std::ostringstream contents;
+  contents << jar.rdbuf();
+  const std::string &bytes = contents.str();
+
+  std::ostringstream name;
+  name << 'v' << JAVA_CLASS_CACHE_VERSION << '-' << std::hex
+       << std::setfill('0') << std::setw(2 * sizeof(std::size_t))
+       << hash_string(bytes) << '-' << std::dec << bytes.size();
+
+  entry.first->second = concat_dir_file(directory, name.str());
+  return entry.first->second;
+}
+
+std::string java_class_cachet::entry_path(
+  const std::string &jar_path,
+  const irep_idt &class_name)
+{
+  return concat_dir_file(
+    jar_directory(jar_path), id2string(class_name) + ".jcc");
+}
+
+optionalt<java_bytecode_parse_treet> java_class_cachet::load(
+  const std::string &jar_path,
+  const irep_idt &class_name,
+  message_handlert &message_handler)
+{
+  const std::string path = entry_path(jar_path, class_name);
+  std::ifstream in(path, std::ios::binary);
+  if(!in)
+    return {};
+
+  auto parse_tree = read_java_class_cache_entry(in);
+
+  messaget log(message_handler);
+  if(parse_tree.has_value() && parse_tree->parsed_class.name == class_name)
+  {
+    log.debug() << "Getting class '" << class_name << "' from class cache "
+                << path << messaget::eom;
+    return parse_tree;
+  }
+
+  log.debug() << "Ignoring unreadable class cache entry " << path
+              << messaget::eom;
+  return {};
+}
+
+void java_class_cachet::store(
+  const std::string &jar_path,
+  const java_bytecode_parse_treet &parse_tree,
+  message_handlert &message_handler)
+{
+  messaget log(message_handler);
+  const std::string &jar_dir = jar_directory(jar_path);
+  if(!is_directory(directory))
+    create_directory(directory);
+  if(!is_directory(jar_dir))
+    create_directory(jar_dir);
+
+  const std::string path = entry_path(jar_path, parse_tree.parsed_class.name);
+
+  // write to a private file first so that concurrent readers never see a
+  // partially written entry
+  std::random_device random;
+  const std::string temporary_path =
+    path + "." + std::to_string(random()) + ".tmp";
+
+  {
+    std::ofstream out(temporary_path, std::ios::binary);
+    if(out)
+      write_java_class_cache_entry(out, parse_tree);
+    if(!out)
+    {
+      log.warning() << "failed to write class cache entry " << temporary_path
+                    << messaget::eom;
+      file_remove(temporary_path);
+      return;
+    }
+  }
+
+  try
+  {
+    file_rename(temporary_path, path);
+  }
+  catch(const system_exceptiont &)
+  {
+    log.warning() << "failed to write class cache entry " << path
+                  << messaget::eom;
+    file_remove(temporary_path);
+  }
+}
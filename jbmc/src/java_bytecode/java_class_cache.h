@@ -0,0 +1,81 @@
+/*******************************************************************\
+
+Module: On-disk cache of parsed Java class files
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// On-disk cache of parsed Java class files
+
+#ifndef CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
+#define CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
+
+#include <iosfwd>
+#include <map>
+#include <string>
+
+#include <util/optional.h>
+
+#include "java_bytecode_parse_tree.h"
+
+class message_handlert;
+
+/// Version of the binary format written by \ref write_java_class_cache_entry.
+/// Bump this whenever \ref java_bytecode_parse_treet or the serialisation
+/// changes, so that stale cache entries are ignored rather than misread.
+#define JAVA_CLASS_CACHE_VERSION 1
+
+/// Persistent cache of the parse trees of classes loaded from JAR files, for
+/// example the models library, which is loaded by every run. Entries are
+/// stored in a subdirectory of the cache directory whose name is derived from
+/// the contents of the JAR and the cache format version, so rebuilding a JAR
+/// invalidates its entries. Several processes may share one cache directory:
+/// entries are written to a temporary file that is then renamed into place.
+class java_class_cachet
+{
+public:
+  explicit java_class_cachet(std::string directory)
+    : directory(std::move(directory))
+  {
+  }
+
+  /// Look up the parse tree of \p class_name loaded from \p jar_path.
+  /// \return the cached parse tree, or an empty optionalt if there is no
+  ///   usable entry
+  optionalt<java_bytecode_parse_treet> load(
+    const std::string &jar_path,
+    const irep_idt &class_name,
+    message_handlert &message_handler);
+
+  /// Store \p parse_tree as the entry for its class loaded from \p jar_path.
+  /// Failures to write are reported as warnings but are otherwise ignored.
+  void store(
+    const std::string &jar_path,
+    const java_bytecode_parse_treet &parse_tree,
+    message_handlert &message_handler);
+
+private:
+  std::string directory;
+
+  /// Cache subdirectory for each JAR file seen so far, so that each JAR is
+  /// hashed at most once per run
+  std::map<std::string, std::string> jar_directories;
+
+  const std::string &jar_directory(const std::string &jar_path);
+  std::string entry_path(const std::string &jar_path, const irep_idt &);
+};
+
+/// Write \p parse_tree to \p out in the cache entry format.
+void write_java_class_cache_entry(
+  std::ostream &out,
+  const java_bytecode_parse_treet &parse_tree);
+
+/// Read a parse tree written by \ref write_java_class_cache_entry.
+/// \return the parse tree, or an empty optionalt if \p in does not hold an
+///   entry of the current \ref JAVA_CLASS_CACHE_VERSION
+optionalt<java_bytecode_parse_treet>
+read_java_class_cache_entry(std::istream &in);
+
+#endif // CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
@@ -161,6 +161,13 @@ java_class_loader_baset::get_class_from_jar(
 {
   messaget log(message_handler);
 
+  if(class_cache)
+  {
+    auto cached = class_cache->load(jar_file, class_name, message_handler);
+    if(cached.has_value())
+      return cached;
+  }
+
   try
   {
     auto &jar = jar_pool(jar_file);
@@ -173,7 +180,12 @@ java_class_loader_baset::get_class_from_jar(
                 << messaget::eom;
 
     std::istringstream istream(*data);
-    return java_bytecode_parse(istream, class_name, message_handler);
+    auto parse_tree = java_bytecode_parse(istream, class_name, message_handler);
+
+    if(class_cache && parse_tree.has_value())
+      class_cache->store(jar_file, *parse_tree, message_handler);
+
+    return parse_tree;
   }
   catch(const std::runtime_error &)
   {
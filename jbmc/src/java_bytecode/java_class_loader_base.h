@@ -11,6 +11,9 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "jar_pool.h"
 #include "java_bytecode_parse_tree.h"
+#include "java_class_cache.h"
+
+#include <util/make_unique.h>
 
 class message_handlert;
 
@@ -34,6 +37,14 @@ public:
   static std::string class_name_to_os_file(const irep_idt &);
   static std::string class_name_to_jar_file(const irep_idt &);
 
+  /// Keep the parse trees of classes loaded from JAR files in an on-disk
+  /// cache in \p directory, and reuse them instead of parsing the class
+  /// files again on later runs.
+  void set_class_cache(const std::string &directory)
+  {
+    class_cache = util_make_unique<java_class_cachet>(directory);
+  }
+
   /// a cache for jar_filet, by path name
   jar_poolt jar_pool;
 
@@ -54,6 +65,9 @@ protected:
   /// List of entries in the classpath
   std::list<classpath_entryt> classpath_entries;
 
+  /// Persistent cache of parsed classes, if enabled
+  std::unique_ptr<java_class_cachet> class_cache;
+
   /// attempt to load a class from a classpath_entry
   optionalt<java_bytecode_parse_treet> load_class(
     const irep_idt &class_name,
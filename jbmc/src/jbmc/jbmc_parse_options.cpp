@@ -268,6 +268,21 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
     "slice-formula",
     cmdline.isset("slice-formula"));
 
+  if(cmdline.isset("stream-ssa"))
+  {
+    if(cmdline.isset("slice-formula") || cmdline.isset("paths"))
+    {
+      log.error() << "--stream-ssa must not be given together with "
+                  << "--slice-formula or --paths" << messaget::eom;
+      exit(1); // should contemplate EX_USAGE from sysexits.h
+    }
+
+    // steps are converted before the equation is complete, hence they can
+    // no longer be sliced away
+    options.set_option("stream-ssa", true);
+    options.set_option("simple-slice", false);
+  }
+
   // simplify if conditions and branches
   if(cmdline.isset("no-simplify-if"))
     options.set_option("simplify-if", false);
@@ -457,6 +472,18 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
 
   if(cmdline.isset("show-goto-symex-steps"))
     options.set_option("show-goto-symex-steps", true);
+
+  if(cmdline.isset("hash-consing"))
+    options.set_option("hash-consing", true);
+
+  if(cmdline.isset("max-auto-objects"))
+  {
+    options.set_option(
+      "max-auto-objects", cmdline.get_value("max-auto-objects"));
+  }
+
+  if(cmdline.isset("function-summaries"))
+    options.set_option("function-summaries", true);
 }
 
 /// invoke main modules
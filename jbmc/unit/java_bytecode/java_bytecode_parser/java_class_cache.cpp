@@ -0,0 +1,110 @@
+/*******************************************************************\
+
+Module: Unit tests for the on-disk cache of parsed classes
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <java_bytecode/java_bytecode_parse_tree.h>
+#include <java_bytecode/java_bytecode_parser.h>
+#include <java_bytecode/java_class_cache.h>
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <sstream>
+
+static void require_same_method(
+  const java_bytecode_parse_treet::methodt &method,
+  const java_bytecode_parse_treet::methodt &original)
+{
+  REQUIRE(method.name == original.name);
+  REQUIRE(method.descriptor == original.descriptor);
+  REQUIRE(method.is_public == original.is_public);
+  REQUIRE(method.annotations.size() == original.annotations.size());
+  REQUIRE(method.instructions.size() == original.instructions.size());
+  for(std::size_t i = 0; i < method.instructions.size(); ++i)
+  {
+    REQUIRE(
+      method.instructions[i].address == original.instructions[i].address);
+    REQUIRE(
+      method.instructions[i].bytecode == original.instructions[i].bytecode);
+    REQUIRE(method.instructions[i].args == original.instructions[i].args);
+  }
+  REQUIRE(
+    method.local_variable_table.size() == original.local_variable_table.size());
+  REQUIRE(method.exception_table.size() == original.exception_table.size());
+  REQUIRE(method.stack_map_table.size() == original.stack_map_table.size());
+}
+
+SCENARIO(
+  "java_class_cache_entry_round_trip",
+  "[core][java_bytecode][java_bytecode_parser]")
+{
+  GIVEN("A parsed class with fields, annotations and exception tables")
+  {
+    auto parsed = java_bytecode_parse(
+      "./java_bytecode/java_bytecode_parser/Trivial$Inner.class",
+      "Trivial$Inner",
+      null_message_handler);
+    REQUIRE(parsed);
+
+    std::stringstream entry;
+    write_java_class_cache_entry(entry, *parsed);
+
+    WHEN("Reading the cache entry back")
+    {
+      auto cached = read_java_class_cache_entry(entry);
+
+      THEN("The parse tree is restored unchanged")
+      {
+        REQUIRE(cached);
+        const auto &cached_class = cached->parsed_class;
+        const auto &original_class = parsed->parsed_class;
+        REQUIRE(cached_class.name == original_class.name);
+        REQUIRE(cached_class.super_class == original_class.super_class);
+        REQUIRE(cached_class.outer_class == original_class.outer_class);
+        REQUIRE(cached_class.is_inner_class == original_class.is_inner_class);
+        REQUIRE(cached_class.annotations.size() == 1);
+        REQUIRE(
+          cached_class.annotations[0].type ==
+          original_class.annotations[0].type);
+        REQUIRE(cached_class.fields.size() == original_class.fields.size());
+        REQUIRE(cached_class.methods.size() == original_class.methods.size());
+        require_same_method(
+          cached_class.methods.front(), original_class.methods.front());
+        require_same_method(
+          cached_class.methods.back(), original_class.methods.back());
+        REQUIRE(cached->class_refs == parsed->class_refs);
+        REQUIRE(cached->loading_successful == parsed->loading_successful);
+      }
+    }
+
+    WHEN("Reading an entry written with another format version")
+    {
+      std::string contents = entry.str();
+      // the version number directly follows the three magic bytes
+      contents[3] = static_cast<char>(JAVA_CLASS_CACHE_VERSION + 1);
+      std::istringstream stale(contents);
+
+      THEN("The entry is rejected")
+      {
+        REQUIRE_FALSE(read_java_class_cache_entry(stale));
+      }
+    }
+
+    WHEN("Reading an entry that was cut short")
+    {
+      const std::string contents = entry.str();
+
+      THEN("Every truncation of the entry is rejected")
+      {
+        for(std::size_t size = 0; size < contents.size(); ++size)
+        {
+          std::istringstream truncated(contents.substr(0, size));
+          REQUIRE_FALSE(read_java_class_cache_entry(truncated));
+        }
+      }
+    }
+  }
+}
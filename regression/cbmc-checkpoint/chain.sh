@@ -0,0 +1,22 @@
+#!/bin/bash
+
+# Run cbmc twice with --checkpoint, such that the second run replaces the
+# checkpoint of the first, and then once more resuming from that checkpoint.
+
+cbmc=$1
+
+name=${*:$#}
+args=${*:2:$#-2}
+checkpoint="${name%.c}.checkpoint"
+
+rm -f "${checkpoint}"
+
+for run in 1 2 ; do
+  $cbmc ${name} ${args} --checkpoint "${checkpoint}" > /dev/null
+  if [ ! -e "${checkpoint}" ] ; then
+    echo "run ${run} did not write ${checkpoint}"
+    exit 1
+  fi
+done
+
+$cbmc ${name} ${args} --resume "${checkpoint}"
@@ -0,0 +1,8 @@
+int main()
+{
+  int x;
+  __CPROVER_assume(x > 0);
+  __CPROVER_assert(x != 0, "holds");
+  __CPROVER_assert(x != 1, "fails");
+  return 0;
+}
@@ -0,0 +1,14 @@
+int main()
+{
+  int x = 0;
+
+  while(1)
+  {
+    __CPROVER_assert(x >= 0 && x <= 10, "x in range");
+
+    if(x < 10)
+      x++;
+    else
+      x = 0;
+  }
+}
@@ -0,0 +1,12 @@
+int a[2];
+
+int main()
+{
+  while(1)
+  {
+    __CPROVER_assert(a[0] < 10, "a[0] below 10");
+
+    // a is only written by array_set, which the step case has to havoc
+    __CPROVER_array_set(a, a[0] + 1);
+  }
+}
@@ -0,0 +1,21 @@
+int g;
+
+void f(int x)
+{
+  int y = x * 2;
+  __CPROVER_assert(y != 4, "f fails for 2");
+}
+
+void h(int x)
+{
+  g = x;
+  __CPROVER_assert(g == x, "h holds");
+}
+
+int main()
+{
+  int a;
+  f(a);
+  h(a);
+  return 0;
+}
@@ -0,0 +1,21 @@
+void f(void)
+{
+  int a = 0;
+  for(int i = 0; i < 2; ++i)
+    a++;
+
+  int b = 0;
+  for(int j = 0; j < 5; ++j)
+    b++;
+
+  __CPROVER_assert(b == 5, "second loop ran five times");
+}
+
+int main()
+{
+  int x;
+  __CPROVER_assume(x > 0);
+  f();
+  __CPROVER_assert(x != 0, "x is positive");
+  return 0;
+}
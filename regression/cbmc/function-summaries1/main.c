@@ -0,0 +1,18 @@
+unsigned rotate_left(unsigned x, unsigned n)
+{
+  unsigned result = (x << n) | (x >> (32 - n));
+  return result;
+}
+
+int main()
+{
+  unsigned x;
+  unsigned y = x;
+
+  for(int i = 0; i < 8; ++i)
+    y = rotate_left(y, 4);
+
+  __CPROVER_assert(y == x, "rotating by 32 bits is the identity");
+  __CPROVER_assert(y != x, "rotating by 32 bits changes the value");
+  return 0;
+}
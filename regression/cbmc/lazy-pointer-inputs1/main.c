@@ -0,0 +1,16 @@
+#include <assert.h>
+
+struct list
+{
+  int value;
+  struct list *next;
+};
+
+void f(struct list *l)
+{
+  if(l && l->next)
+  {
+    assert(l->next->value != 42);
+    assert(l->next != l);
+  }
+}
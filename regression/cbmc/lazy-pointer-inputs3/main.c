@@ -0,0 +1,16 @@
+#include <assert.h>
+
+struct list
+{
+  int value;
+  struct list *next;
+};
+
+void f(struct list *l)
+{
+  if(l && l->next)
+  {
+    assert(l->next == l);
+    assert(l->next->next == l);
+  }
+}
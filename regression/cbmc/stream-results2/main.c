@@ -0,0 +1,9 @@
+int main()
+{
+  int x;
+  int y;
+  __CPROVER_assert(x != 1, "first");
+  __CPROVER_assert(y != 2, "second");
+  __CPROVER_assert(x == x, "third");
+  return 0;
+}
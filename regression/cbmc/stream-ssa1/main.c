@@ -0,0 +1,21 @@
+#include <assert.h>
+
+int nondet_int();
+
+int main()
+{
+  int x = nondet_int();
+  int sum = 0;
+
+  for(int i = 0; i < 5; ++i)
+  {
+    if(x > i)
+      sum += i;
+  }
+
+  __CPROVER_assume(x < 10);
+  assert(sum != 10);
+  assert(sum <= 10);
+
+  return 0;
+}
@@ -0,0 +1,20 @@
+int main()
+{
+  int n;
+  int x = 0;
+
+  // the bound is unknown, so the intervals only stabilise with widening
+  while(x < n)
+    x++;
+
+  __CPROVER_assert(x >= 0, "x>=0");
+
+  int i = 0;
+
+  // widening to the loop bound keeps the exit value precise
+  while(i < 100)
+    i++;
+
+  __CPROVER_assert(i == 100, "i==100");
+  __CPROVER_assert(i < 100, "i<100");
+}
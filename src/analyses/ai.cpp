@@ -11,10 +11,14 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "ai.h"
 
+#include <map>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <type_traits>
+#include <vector>
 
+#include <util/arith_tools.h>
 #include <util/invariant.h>
 #include <util/std_code.h>
 #include <util/std_expr.h>
@@ -203,6 +207,130 @@ void ai_baset::finalize()
   // Nothing to do per default
 }
 
+void ai_baset::collect_widening_thresholds(const goto_programt &goto_program)
+{
+  if(!widening)
+    return;
+
+  auto collect = [this](const exprt &expr) {
+    if(
+      expr.id() != ID_constant ||
+      (expr.type().id() != ID_signedbv && expr.type().id() != ID_unsignedbv))
+    {
+      return;
+    }
+
+    // Loop conditions commonly compare against a bound or one off it
+    if(const auto value = numeric_cast<mp_integer>(expr))
+    {
+      widening_thresholds.insert(*value - 1);
+      widening_thresholds.insert(*value);
+      widening_thresholds.insert(*value + 1);
+    }
+  };
+
+  forall_goto_program_instructions(i_it, goto_program)
+  {
+    i_it->code.visit_pre(collect);
+    i_it->get_condition().visit_pre(collect);
+  }
+}
+
+void ai_baset::collect_widening_thresholds(
+  const goto_functionst &goto_functions)
+{
+  forall_goto_functions(it, goto_functions)
+    collect_widening_thresholds(it->second.body);
+}
+
+void ai_baset::narrow(
+  const irep_idt &function_id,
+  const goto_programt &goto_program,
+  const namespacet &ns)
+{
+  if(!widening || !domain_factory->has_widening())
+    return;
+
+  // The predecessors within this function body, which is all that determines
+  // the state except at the entry and after function calls
+  std::map<locationt, std::vector<locationt>> predecessors;
+  std::set<locationt> excluded;
+  if(!goto_program.instructions.empty())
+    excluded.insert(goto_program.instructions.begin());
+
+  forall_goto_program_instructions(i_it, goto_program)
+  {
+    if(i_it->is_function_call())
+    {
+      excluded.insert(std::next(i_it));
+      continue;
+    }
+
+    for(const auto &to_l : goto_program.get_successors(i_it))
+    {
+      if(to_l != goto_program.instructions.end())
+        predecessors[to_l].push_back(i_it);
+    }
+  }
+
+  auto single_trace = [this](locationt l) -> trace_ptrt {
+    auto traces = storage->abstract_traces_before(l);
+    return traces->size() == 1 ? *traces->begin() : nullptr;
+  };
+
+  // Two descending passes recover most of the precision; each of them keeps
+  // the result a post-fixed point, so stopping at any time is sound.
+  for(std::size_t pass = 0; pass < 2; ++pass)
+  {
+    for(const auto &entry : predecessors)
+    {
+      const locationt to_l = entry.first;
+      if(excluded.find(to_l) != excluded.end())
+        continue;
+
+      trace_ptrt to_p = single_trace(to_l);
+      if(to_p == nullptr || get_state(to_p).is_bottom())
+        continue;
+
+      std::unique_ptr<statet> new_values = domain_factory->make(to_l);
+      bool precise = true;
+
+      for(const auto &from_l : entry.second)
+      {
+        trace_ptrt from_p = single_trace(from_l);
+        if(from_p == nullptr)
+        {
+          // unreached predecessors have no traces and contribute nothing
+          if(storage->abstract_traces_before(from_l)->empty())
+            continue;
+          precise = false;
+          break;
+        }
+
+        std::unique_ptr<statet> tmp_state(
+          make_temporary_state(get_state(from_p)));
+        tmp_state->transform(function_id, from_p, function_id, to_p, *this, ns);
+        domain_factory->merge(*new_values, *tmp_state, from_p, to_p);
+      }
+
+      if(!precise)
+        continue;
+
+      statet &current = get_state(to_p);
+      current.make_bottom();
+      domain_factory->merge(current, *new_values, to_p, to_p);
+    }
+  }
+}
+
+void ai_baset::narrow(
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  forall_goto_functions(it, goto_functions)
+    narrow(it->first, it->second.body, ns);
+}
+
 ai_baset::trace_ptrt ai_baset::get_next(working_sett &working_set)
 {
   PRECONDITION(!working_set.empty());
@@ -344,8 +472,13 @@ bool ai_baset::visit_edge(
   // Expanding a domain means that it has to be analysed again
   // Likewise if the history insists that it is a new trace
   // (assuming it is actually reachable).
+  // Widen on back edges, whose targets are the loop heads
+  const bool widen_here = widening && function_id == to_function_id &&
+                          to_l->location_number <=
+                            p->current_location()->location_number;
+
   if(
-    merge(new_values, p, to_p) ||
+    (widen_here ? widen(new_values, p, to_p) : merge(new_values, p, to_p)) ||
     (next.first == ai_history_baset::step_statust::NEW &&
      !new_values.is_bottom()))
   {
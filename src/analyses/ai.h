@@ -148,8 +148,10 @@ public:
   {
     goto_functionst goto_functions;
     initialize(function_id, goto_program);
+    collect_widening_thresholds(goto_program);
     trace_ptrt p = entry_state(goto_program);
     fixedpoint(p, function_id, goto_program, goto_functions, ns);
+    narrow(function_id, goto_program, ns);
     finalize();
   }
 
@@ -159,8 +161,10 @@ public:
     const namespacet &ns)
   {
     initialize(goto_functions);
+    collect_widening_thresholds(goto_functions);
     trace_ptrt p = entry_state(goto_functions);
     fixedpoint(p, goto_functions, ns);
+    narrow(goto_functions, ns);
     finalize();
   }
 
@@ -169,8 +173,10 @@ public:
   {
     const namespacet ns(goto_model.get_symbol_table());
     initialize(goto_model.get_goto_functions());
+    collect_widening_thresholds(goto_model.get_goto_functions());
     trace_ptrt p = entry_state(goto_model.get_goto_functions());
     fixedpoint(p, goto_model.get_goto_functions(), ns);
+    narrow(goto_model.get_goto_functions(), ns);
     finalize();
   }
 
@@ -182,11 +188,21 @@ public:
   {
     goto_functionst goto_functions;
     initialize(function_id, goto_function);
+    collect_widening_thresholds(goto_function.body);
     trace_ptrt p = entry_state(goto_function.body);
     fixedpoint(p, function_id, goto_function.body, goto_functions, ns);
+    narrow(function_id, goto_function.body, ns);
     finalize();
   }
 
+  /// Widen instead of merging at loop heads, for domains that support it
+  /// (see \ref ai_domain_baset). The loss of precision is partly recovered by
+  /// a descending phase once the fixed point has been reached.
+  void enable_widening()
+  {
+    widening = true;
+  }
+
   /// Returns all of the histories that have reached
   /// the start of the instruction.
   /// PRECONDITION(l is dereferenceable)
@@ -381,6 +397,28 @@ protected:
   /// has run
   virtual void finalize();
 
+  /// Whether to widen at loop heads, see \ref enable_widening
+  bool widening = false;
+
+  /// Bounds to widen to, see \ref ai_domain_baset::widening_thresholdst
+  ai_domain_baset::widening_thresholdst widening_thresholds;
+
+  /// Record the integer constants in \p goto_program as widening thresholds
+  void collect_widening_thresholds(const goto_programt &goto_program);
+  void collect_widening_thresholds(const goto_functionst &goto_functions);
+
+  /// Descending phase after a fixed point computed with widening: recompute
+  /// the state at each location from the states of its predecessors, which
+  /// can only improve on the over-approximation introduced by widening.
+  /// States at function entries and after function calls, which depend on
+  /// other functions, and states of locations with more than one history are
+  /// left unchanged.
+  void narrow(
+    const irep_idt &function_id,
+    const goto_programt &goto_program,
+    const namespacet &ns);
+  void narrow(const goto_functionst &goto_functions, const namespacet &ns);
+
   /// Set the abstract state of the entry location of a single function to the
   /// entry state required by the analysis
   trace_ptrt entry_state(const goto_programt &goto_program);
@@ -502,6 +540,13 @@ protected:
     return domain_factory->merge(dest, src, from, to);
   }
 
+  /// As \ref merge, but widen the result
+  virtual bool widen(const statet &src, trace_ptrt from, trace_ptrt to)
+  {
+    statet &dest = get_state(to);
+    return domain_factory->widen(dest, src, from, to, widening_thresholds);
+  }
+
   /// Make a copy of a state
   virtual std::unique_ptr<statet> make_temporary_state(const statet &s)
   {
@@ -36,6 +36,10 @@ Author: Daniel Kroening, kroening@kroening.com
 /// default constructor is fine and inheriting from
 /// ai_domain_factoryt<your_domain> will be fine if non-trivial constructors
 /// are needed.
+///
+/// Domains of large height, such as intervals, may additionally provide a
+/// widen method, which the analysis then uses at loop heads when widening is
+/// enabled, see \ref ai_baset::enable_widening.
 
 #ifndef CPROVER_ANALYSES_AI_DOMAIN_H
 #define CPROVER_ANALYSES_AI_DOMAIN_H
@@ -44,12 +48,17 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/expr.h>
 #include <util/json.h>
 #include <util/make_unique.h>
+#include <util/mp_arith.h>
 #include <util/xml.h>
 
 #include <goto-programs/goto_model.h>
 
 #include "ai_history.h"
 
+#include <set>
+#include <type_traits>
+#include <utility>
+
 // forward reference the abstract interpreter interface
 class ai_baset;
 
@@ -77,6 +86,10 @@ public:
   typedef goto_programt::const_targett locationt;
   typedef ai_history_baset::trace_ptrt trace_ptrt;
 
+  /// Integer constants occurring in the program, which widening uses as
+  /// bounds before giving up on a bound altogether
+  typedef std::set<mp_integer> widening_thresholdst;
+
   /// how function calls are treated:
   /// a) there is an edge from each call site to the function head
   /// b) there is an edge from the last instruction (END_FUNCTION)
@@ -142,6 +155,20 @@ public:
   /// PRECONDITION(from.is_dereferenceable(), "Must not be _::end()")
   /// PRECONDITION(to.is_dereferenceable(), "Must not be _::end()")
 
+  /// optionally also add
+  ///
+  ///   bool widen(
+  ///     const T &b,
+  ///     locationt from,
+  ///     locationt to,
+  ///     const widening_thresholdst &thresholds);
+  ///
+  /// This computes the join between "this" and "b" and then widens the
+  /// result, such that any sequence of widenings becomes stable after
+  /// finitely many steps. Bounds that grow should be moved to the next
+  /// value in "thresholds", or dropped if there is none.
+  /// Return true if "this" has changed.
+
   /// This method allows an expression to be simplified / evaluated using the
   /// current state.  It is used to evaluate assertions and in program
   /// simplification
@@ -186,6 +213,44 @@ public:
   virtual bool
   merge(statet &dest, const statet &src, trace_ptrt from, trace_ptrt to)
     const = 0;
+
+  /// Merge as above, but widen the result. Domains that do not provide a
+  /// widen method are merged.
+  virtual bool widen(
+    statet &dest,
+    const statet &src,
+    trace_ptrt from,
+    trace_ptrt to,
+    const ai_domain_baset::widening_thresholdst &thresholds) const
+  {
+    (void)thresholds; // unused parameter
+    return merge(dest, src, from, to);
+  }
+
+  /// Whether \ref widen does more than merge
+  virtual bool has_widening() const
+  {
+    return false;
+  }
+};
+
+/// Whether \p domainT provides a widen method as described in
+/// \ref ai_domain_baset
+template <typename domainT, typename = void>
+struct ai_domain_has_wident : std::false_type
+{
+};
+
+template <typename domainT>
+struct ai_domain_has_wident<
+  domainT,
+  decltype(void(std::declval<domainT &>().widen(
+    std::declval<const domainT &>(),
+    std::declval<ai_domain_baset::locationt>(),
+    std::declval<ai_domain_baset::locationt>(),
+    std::declval<const ai_domain_baset::widening_thresholdst &>())))>
+  : std::true_type
+{
 };
 // Converting make to take a trace_ptr instead of a location would
 // require removing the backwards-compatible
@@ -218,6 +283,49 @@ public:
       from->current_location(),
       to->current_location());
   }
+
+  bool widen(
+    statet &dest,
+    const statet &src,
+    trace_ptrt from,
+    trace_ptrt to,
+    const ai_domain_baset::widening_thresholdst &thresholds) const override
+  {
+    return widen(
+      dest, src, from, to, thresholds, ai_domain_has_wident<domainT>());
+  }
+
+  bool has_widening() const override
+  {
+    return ai_domain_has_wident<domainT>::value;
+  }
+
+private:
+  bool widen(
+    statet &dest,
+    const statet &src,
+    trace_ptrt from,
+    trace_ptrt to,
+    const ai_domain_baset::widening_thresholdst &thresholds,
+    std::true_type) const
+  {
+    return static_cast<domainT &>(dest).widen(
+      static_cast<const domainT &>(src),
+      from->current_location(),
+      to->current_location(),
+      thresholds);
+  }
+
+  bool widen(
+    statet &dest,
+    const statet &src,
+    trace_ptrt from,
+    trace_ptrt to,
+    const ai_domain_baset::widening_thresholdst &,
+    std::false_type) const
+  {
+    return merge(dest, src, from, to);
+  }
 };
 
 template <typename domainT>
@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "goto_check.h"
 
 #include <algorithm>
+#include <memory>
 
 #include <util/arith_tools.h>
 #include <util/array_name.h>
@@ -2295,3 +2296,19 @@ void goto_check(
   const namespacet ns(goto_model.symbol_table);
   goto_check(ns, options, goto_model.goto_functions);
 }
+
+goto_function_passest::passt goto_check_pass(
+  const namespacet &ns,
+  const optionst &options,
+  const goto_functionst &goto_functions)
+{
+  // the pass may be copied, but all copies share the one checker
+  auto checker = std::make_shared<goto_checkt>(ns, options);
+  checker->collect_allocations(goto_functions);
+
+  return [checker](
+           const irep_idt &function_identifier,
+           goto_functionst::goto_functiont &goto_function) {
+    checker->goto_check(function_identifier, goto_function);
+  };
+}
@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_ANALYSES_GOTO_CHECK_H
 #define CPROVER_ANALYSES_GOTO_CHECK_H
 
+#include <goto-programs/goto_function_passes.h>
 #include <goto-programs/goto_functions.h>
 #include <goto-programs/goto_model.h>
 
@@ -33,6 +34,16 @@ void goto_check(
   const optionst &options,
   goto_modelt &goto_model);
 
+/// Create a pass that adds the checks enabled in \p options to a single
+/// function, for use with \ref goto_function_passest. Unlike the per-function
+/// overload of \ref goto_check, the pass knows about the allocations declared
+/// by calls to __CPROVER_allocated_memory in \p goto_functions, which are
+/// collected when the pass is created.
+goto_function_passest::passt goto_check_pass(
+  const namespacet &ns,
+  const optionst &options,
+  const goto_functionst &goto_functions);
+
 #define OPT_GOTO_CHECK                                                         \
   "(bounds-check)(pointer-check)(memory-leak-check)"                           \
   "(div-by-zero-check)(enum-range-check)(signed-overflow-check)(unsigned-"     \
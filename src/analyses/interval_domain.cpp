@@ -31,29 +31,63 @@ void interval_domaint::output(
     return;
   }
 
-  for(const auto &interval : int_map)
-  {
-    if(interval.second.is_top())
-      continue;
-    if(interval.second.lower_set)
-      out << interval.second.lower << " <= ";
-    out << interval.first;
-    if(interval.second.upper_set)
-      out << " <= " << interval.second.upper;
-    out << "\n";
-  }
+  int_map.iterate(
+    [&out](const irep_idt &identifier, const integer_intervalt &interval) {
+      if(interval.is_top())
+        return;
+      if(interval.lower_set)
+        out << interval.lower << " <= ";
+      out << identifier;
+      if(interval.upper_set)
+        out << " <= " << interval.upper;
+      out << "\n";
+    });
+
+  float_map.iterate(
+    [&out](const irep_idt &identifier, const ieee_float_intervalt &interval) {
+      if(interval.is_top())
+        return;
+      if(interval.lower_set)
+        out << interval.lower << " <= ";
+      out << identifier;
+      if(interval.upper_set)
+        out << " <= " << interval.upper;
+      out << "\n";
+    });
+}
 
-  for(const auto &interval : float_map)
-  {
-    if(interval.second.is_top())
-      continue;
-    if(interval.second.lower_set)
-      out << interval.second.lower << " <= ";
-    out << interval.first;
-    if(interval.second.upper_set)
-      out << " <= " << interval.second.upper;
-    out << "\n";
-  }
+integer_intervalt
+interval_domaint::get_int_interval(const irep_idt &identifier) const
+{
+  const auto entry = int_map.find(identifier);
+  return entry ? entry->get() : integer_intervalt();
+}
+
+ieee_float_intervalt
+interval_domaint::get_float_interval(const irep_idt &identifier) const
+{
+  const auto entry = float_map.find(identifier);
+  return entry ? entry->get() : ieee_float_intervalt();
+}
+
+void interval_domaint::set_int_interval(
+  const irep_idt &identifier,
+  const integer_intervalt &interval)
+{
+  if(interval.is_top())
+    int_map.erase_if_exists(identifier);
+  else
+    int_map.insert_or_replace(identifier, interval);
+}
+
+void interval_domaint::set_float_interval(
+  const irep_idt &identifier,
+  const ieee_float_intervalt &interval)
+{
+  if(interval.is_top())
+    float_map.erase_if_exists(identifier);
+  else
+    float_map.insert_or_replace(identifier, interval);
 }
 
 void interval_domaint::transform(
@@ -139,6 +173,48 @@ void interval_domaint::transform(
   }
 }
 
+/// Join each interval in \p map with the one of the same variable in \p other.
+/// Variables that are not in \p other are unconstrained there and are erased.
+/// Only the entries in subtrees that the maps do not share are visited.
+/// \return true if \p map changed
+template <class mapt>
+static bool join_maps(mapt &map, const mapt &other)
+{
+  typename mapt::delta_viewt delta_view;
+  map.get_delta_view(other, delta_view, false);
+
+  // Collect the changes first as the delta view refers into the map
+  std::vector<irep_idt> erased;
+  std::vector<std::pair<irep_idt, typename mapt::mapped_type>> joined;
+
+  for(const auto &entry : delta_view)
+  {
+    if(!entry.is_in_both_maps())
+    {
+      erased.push_back(entry.k);
+      continue;
+    }
+
+    typename mapt::mapped_type interval = entry.m;
+    interval.join(entry.get_other_map_value());
+    if(interval != entry.m)
+      joined.emplace_back(entry.k, std::move(interval));
+  }
+
+  for(const auto &identifier : erased)
+    map.erase(identifier);
+
+  for(auto &entry : joined)
+  {
+    if(entry.second.is_top())
+      map.erase(entry.first);
+    else
+      map.replace(entry.first, std::move(entry.second));
+  }
+
+  return !erased.empty() || !joined.empty();
+}
+
 /// Sets *this to the mathematical join between the two domains. This can be
 /// thought of as an abstract version of union; *this is increased so that it
 /// contains all of the values that are represented by b as well as its original
@@ -162,51 +238,84 @@ bool interval_domaint::join(
     return true;
   }
 
-  bool result=false;
+  const bool int_map_changed = join_maps(int_map, b.int_map);
+  const bool float_map_changed = join_maps(float_map, b.float_map);
+
+  return int_map_changed || float_map_changed;
+}
+
+bool interval_domaint::widen(
+  const interval_domaint &b,
+  locationt,
+  locationt,
+  const widening_thresholdst &thresholds)
+{
+  if(bottom)
+    return join(b);
+
+  const interval_domaint before = *this;
+  if(!join(b))
+    return false;
+
+  // The join only erases variables, hence all variables left in the maps are
+  // also in before, and only those in subtrees that are no longer shared with
+  // before can have grown.
+  int_mapt::delta_viewt int_delta_view;
+  int_map.get_delta_view(before.int_map, int_delta_view);
 
-  for(int_mapt::iterator it=int_map.begin();
-      it!=int_map.end(); ) // no it++
+  std::vector<std::pair<irep_idt, integer_intervalt>> widened_ints;
+  for(const auto &entry : int_delta_view)
   {
-    // search for the variable that needs to be merged
-    // containers have different size and variable order
-    const int_mapt::const_iterator b_it=b.int_map.find(it->first);
-    if(b_it==b.int_map.end())
+    const integer_intervalt &previous = entry.get_other_map_value();
+    integer_intervalt interval = entry.m;
+
+    if(interval.upper_set && interval.upper > previous.upper)
     {
-      it=int_map.erase(it);
-      result=true;
+      const auto t_it = thresholds.lower_bound(interval.upper);
+      if(t_it == thresholds.end())
+        interval.upper_set = false;
+      else
+        interval.upper = *t_it;
     }
-    else
-    {
-      integer_intervalt previous=it->second;
-      it->second.join(b_it->second);
-      if(it->second!=previous)
-        result=true;
 
-      it++;
+    if(interval.lower_set && interval.lower < previous.lower)
+    {
+      auto t_it = thresholds.upper_bound(interval.lower);
+      if(t_it == thresholds.begin())
+        interval.lower_set = false;
+      else
+        interval.lower = *std::prev(t_it);
     }
+
+    if(interval != entry.m)
+      widened_ints.emplace_back(entry.k, std::move(interval));
   }
 
-  for(float_mapt::iterator it=float_map.begin();
-      it!=float_map.end(); ) // no it++
+  for(const auto &entry : widened_ints)
+    set_int_interval(entry.first, entry.second);
+
+  float_mapt::delta_viewt float_delta_view;
+  float_map.get_delta_view(before.float_map, float_delta_view);
+
+  std::vector<std::pair<irep_idt, ieee_float_intervalt>> widened_floats;
+  for(const auto &entry : float_delta_view)
   {
-    const float_mapt::const_iterator b_it=b.float_map.begin();
-    if(b_it==b.float_map.end())
-    {
-      it=float_map.erase(it);
-      result=true;
-    }
-    else
-    {
-      ieee_float_intervalt previous=it->second;
-      it->second.join(b_it->second);
-      if(it->second!=previous)
-        result=true;
+    const ieee_float_intervalt &previous = entry.get_other_map_value();
+    ieee_float_intervalt interval = entry.m;
 
-      it++;
-    }
+    if(interval.upper_set && previous.upper < interval.upper)
+      interval.upper_set = false;
+    if(interval.lower_set && interval.lower < previous.lower)
+      interval.lower_set = false;
+
+    if(interval != entry.m)
+      widened_floats.emplace_back(entry.k, std::move(interval));
   }
 
-  return result;
+  for(const auto &entry : widened_floats)
+    set_float_interval(entry.first, entry.second);
+
+  return true;
 }
 
 void interval_domaint::assign(const code_assignt &code_assign)
@@ -227,9 +336,9 @@ void interval_domaint::havoc_rec(const exprt &lhs)
     irep_idt identifier=to_symbol_expr(lhs).get_identifier();
 
     if(is_int(lhs.type()))
-      int_map.erase(identifier);
+      int_map.erase_if_exists(identifier);
     else if(is_float(lhs.type()))
-      float_map.erase(identifier);
+      float_map.erase_if_exists(identifier);
   }
   else if(lhs.id()==ID_typecast)
   {
@@ -282,20 +391,24 @@ void interval_domaint::assume_rec(
       mp_integer tmp = numeric_cast_v<mp_integer>(to_constant_expr(rhs));
       if(id==ID_lt)
         --tmp;
-      integer_intervalt &ii=int_map[lhs_identifier];
+      integer_intervalt ii = get_int_interval(lhs_identifier);
       ii.make_le_than(tmp);
       if(ii.is_bottom())
         make_bottom();
+      else
+        set_int_interval(lhs_identifier, ii);
     }
     else if(is_float(lhs.type()) && is_float(rhs.type()))
     {
       ieee_floatt tmp(to_constant_expr(rhs));
       if(id==ID_lt)
         tmp.decrement();
-      ieee_float_intervalt &fi=float_map[lhs_identifier];
+      ieee_float_intervalt fi = get_float_interval(lhs_identifier);
       fi.make_le_than(tmp);
       if(fi.is_bottom())
         make_bottom();
+      else
+        set_float_interval(lhs_identifier, fi);
     }
   }
   else if(lhs.id()==ID_constant && rhs.id()==ID_symbol)
@@ -307,20 +420,24 @@ void interval_domaint::assume_rec(
       mp_integer tmp = numeric_cast_v<mp_integer>(to_constant_expr(lhs));
       if(id==ID_lt)
         ++tmp;
-      integer_intervalt &ii=int_map[rhs_identifier];
+      integer_intervalt ii = get_int_interval(rhs_identifier);
       ii.make_ge_than(tmp);
       if(ii.is_bottom())
         make_bottom();
+      else
+        set_int_interval(rhs_identifier, ii);
     }
     else if(is_float(lhs.type()) && is_float(rhs.type()))
     {
       ieee_floatt tmp(to_constant_expr(lhs));
       if(id==ID_lt)
         tmp.increment();
-      ieee_float_intervalt &fi=float_map[rhs_identifier];
+      ieee_float_intervalt fi = get_float_interval(rhs_identifier);
       fi.make_ge_than(tmp);
       if(fi.is_bottom())
         make_bottom();
+      else
+        set_float_interval(rhs_identifier, fi);
     }
   }
   else if(lhs.id()==ID_symbol && rhs.id()==ID_symbol)
@@ -330,21 +447,28 @@ void interval_domaint::assume_rec(
 
     if(is_int(lhs.type()) && is_int(rhs.type()))
     {
-      integer_intervalt &lhs_i=int_map[lhs_identifier];
-      integer_intervalt &rhs_i=int_map[rhs_identifier];
+      integer_intervalt lhs_i = get_int_interval(lhs_identifier);
+      integer_intervalt rhs_i = get_int_interval(rhs_identifier);
       if(id == ID_lt && !lhs_i.is_less_than(rhs_i))
         lhs_i.make_less_than(rhs_i);
       if(id == ID_le && !lhs_i.is_less_than_eq(rhs_i))
         lhs_i.make_less_than_eq(rhs_i);
+      set_int_interval(lhs_identifier, lhs_i);
+      set_int_interval(rhs_identifier, rhs_i);
     }
     else if(is_float(lhs.type()) && is_float(rhs.type()))
     {
-      ieee_float_intervalt &lhs_i=float_map[lhs_identifier];
-      ieee_float_intervalt &rhs_i=float_map[rhs_identifier];
+      ieee_float_intervalt lhs_i = get_float_interval(lhs_identifier);
+      ieee_float_intervalt rhs_i = get_float_interval(rhs_identifier);
       lhs_i.meet(rhs_i);
       rhs_i=lhs_i;
       if(rhs_i.is_bottom())
         make_bottom();
+      else
+      {
+        set_float_interval(lhs_identifier, lhs_i);
+        set_float_interval(rhs_identifier, rhs_i);
+      }
     }
   }
 }
@@ -406,11 +530,11 @@ exprt interval_domaint::make_expression(const symbol_exprt &src) const
 {
   if(is_int(src.type()))
   {
-    int_mapt::const_iterator i_it=int_map.find(src.get_identifier());
-    if(i_it==int_map.end())
+    const auto entry = int_map.find(src.get_identifier());
+    if(!entry)
       return true_exprt();
 
-    const integer_intervalt &interval=i_it->second;
+    const integer_intervalt &interval = entry->get();
     if(interval.is_top())
       return true_exprt();
     if(interval.is_bottom())
@@ -434,11 +558,11 @@ exprt interval_domaint::make_expression(const symbol_exprt &src) const
   }
   else if(is_float(src.type()))
   {
-    float_mapt::const_iterator i_it=float_map.find(src.get_identifier());
-    if(i_it==float_map.end())
+    const auto entry = float_map.find(src.get_identifier());
+    if(!entry)
       return true_exprt();
 
-    const ieee_float_intervalt &interval=i_it->second;
+    const ieee_float_intervalt &interval = entry->get();
     if(interval.is_top())
       return true_exprt();
     if(interval.is_bottom())
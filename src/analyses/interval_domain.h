@@ -15,6 +15,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/ieee_float.h>
 #include <util/integer_interval.h>
 #include <util/interval_template.h>
+#include <util/sharing_map.h>
 
 #include "ai.h"
 
@@ -56,6 +57,15 @@ public:
     return join(b);
   }
 
+  /// Join with \p b, then move any bound that grew to the next of the
+  /// \p thresholds, or drop it if there is none, so that ascending chains
+  /// of intervals at loop heads stabilise.
+  bool widen(
+    const interval_domaint &b,
+    locationt from,
+    locationt to,
+    const widening_thresholdst &thresholds);
+
   // no states
   void make_bottom() final override
   {
@@ -114,8 +124,11 @@ public:
 protected:
   bool bottom;
 
-  typedef std::map<irep_idt, integer_intervalt> int_mapt;
-  typedef std::map<irep_idt, ieee_float_intervalt> float_mapt;
+  // The maps are shared between the domains of different locations, such
+  // that variables that a transformer or merge does not touch are not copied.
+  // Variables that are not in a map are unconstrained.
+  typedef sharing_mapt<irep_idt, integer_intervalt> int_mapt;
+  typedef sharing_mapt<irep_idt, ieee_float_intervalt> float_mapt;
 
   int_mapt int_map;
   float_mapt float_map;
@@ -126,6 +139,11 @@ protected:
   void assign(const class code_assignt &assignment);
   integer_intervalt get_int_rec(const exprt &);
   ieee_float_intervalt get_float_rec(const exprt &);
+
+  integer_intervalt get_int_interval(const irep_idt &) const;
+  ieee_float_intervalt get_float_interval(const irep_idt &) const;
+  void set_int_interval(const irep_idt &, const integer_intervalt &);
+  void set_float_interval(const irep_idt &, const ieee_float_intervalt &);
 };
 
 #endif // CPROVER_ANALYSES_INTERVAL_DOMAIN_H
@@ -358,6 +358,30 @@ bool abstract_environmentt::merge(const abstract_environmentt &env)
   }
 }
 
+void abstract_environmentt::widen(
+  const abstract_environmentt &before,
+  const ai_domain_baset::widening_thresholdst &thresholds)
+{
+  if(bottom || before.bottom)
+    return;
+
+  decltype(map)::delta_viewt delta_view;
+  map.get_delta_view(before.map, delta_view);
+
+  // Collect the widened values first as the delta view refers into the map
+  std::vector<std::pair<map_keyt, abstract_object_pointert>> widened;
+  for(const auto &entry : delta_view)
+  {
+    abstract_object_pointert new_object =
+      entry.m->widen(entry.get_other_map_value(), thresholds);
+    if(new_object != entry.m)
+      widened.emplace_back(entry.k, new_object);
+  }
+
+  for(const auto &entry : widened)
+    map.replace(entry.first, entry.second);
+}
+
 void abstract_environmentt::havoc(const std::string &havoc_string)
 {
   // TODO(tkiley): error reporting
@@ -177,6 +177,15 @@ public:
   /// \return A Boolean, true when the merge has changed something
   virtual bool merge(const abstract_environmentt &env);
 
+  /// Widen the values that changed since \p before, see
+  /// \ref abstract_objectt::widen
+  ///
+  /// \param before: this environment before a merge
+  /// \param thresholds: the values to widen bounds to
+  void widen(
+    const abstract_environmentt &before,
+    const ai_domain_baset::widening_thresholdst &thresholds);
+
   /// This should be used as a default case / everything else has failed
   /// The string is so that I can easily find and diagnose cases where this
   /// occurs
@@ -200,6 +200,13 @@ abstract_object_pointert abstract_objectt::merge(
   return result;
 }
 
+abstract_object_pointert abstract_objectt::widen(
+  const abstract_object_pointert &,
+  const ai_domain_baset::widening_thresholdst &) const
+{
+  return shared_from_this();
+}
+
 bool abstract_objectt::should_use_base_merge(
   const abstract_object_pointert other) const
 {
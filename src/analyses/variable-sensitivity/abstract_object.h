@@ -35,6 +35,7 @@
 #include <stack>
 
 #include "abstract_object_statistics.h"
+#include <analyses/ai_domain.h>
 #include <goto-programs/goto_program.h>
 #include <util/expr.h>
 #include <util/sharing_map.h>
@@ -259,6 +260,18 @@ public:
     abstract_object_pointert op2,
     bool &out_modifications);
 
+  /// Widen this object, which is the result of merging a new value into
+  /// \p before, so that ascending chains of values stabilise. Bounds that
+  /// grew are moved to the next of the \p thresholds, or dropped.
+  /// The default implementation is for abstractions of finite height, which
+  /// need no widening.
+  /// \param before: the object before the merge
+  /// \param thresholds: the values to widen bounds to
+  /// \return the widened object, which is this object if nothing changed
+  virtual abstract_object_pointert widen(
+    const abstract_object_pointert &before,
+    const ai_domain_baset::widening_thresholdst &thresholds) const;
+
   /// Interface method for the meet operation. Decides whether to use the base
   /// implementation or if a more precise abstraction is attainable.
   /// \param op1 lhs object for meet
@@ -71,6 +71,24 @@ abstract_object_pointert context_abstract_objectt::write(
   return result;
 }
 
+/// Widen the wrapped object against the object wrapped by \p before
+abstract_object_pointert context_abstract_objectt::widen(
+  const abstract_object_pointert &before,
+  const ai_domain_baset::widening_thresholdst &thresholds) const
+{
+  abstract_object_pointert widened_child =
+    child_abstract_object->widen(before->unwrap_context(), thresholds);
+
+  if(widened_child == child_abstract_object)
+    return shared_from_this();
+
+  const auto &result =
+    std::dynamic_pointer_cast<context_abstract_objectt>(mutable_clone());
+  result->set_child(widened_child);
+
+  return result;
+}
+
 /**
  * Try to resolve an expression with the maximum level of precision
  * available.
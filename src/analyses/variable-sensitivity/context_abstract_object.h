@@ -86,6 +86,10 @@ public:
 
   abstract_object_pointert unwrap_context() const override;
 
+  abstract_object_pointert widen(
+    const abstract_object_pointert &before,
+    const ai_domain_baset::widening_thresholdst &thresholds) const override;
+
   void get_statistics(
     abstract_object_statisticst &statistics,
     abstract_object_visitedt &visited,
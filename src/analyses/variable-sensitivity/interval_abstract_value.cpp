@@ -9,6 +9,7 @@
 #include <limits.h>
 #include <ostream>
 
+#include <util/arith_tools.h>
 #include <util/invariant.h>
 #include <util/std_expr.h>
 
@@ -542,6 +543,61 @@ const constant_interval_exprt &interval_abstract_valuet::get_interval() const
   return interval;
 }
 
+/// Move integer bounds that grew compared to \p before to the next of the
+/// \p thresholds that the type can represent, or drop them
+abstract_object_pointert interval_abstract_valuet::widen(
+  const abstract_object_pointert &before,
+  const ai_domain_baset::widening_thresholdst &thresholds) const
+{
+  const auto before_interval =
+    std::dynamic_pointer_cast<const interval_abstract_valuet>(before);
+
+  if(
+    !before_interval || is_top() || is_bottom() ||
+    before_interval->is_bottom() ||
+    (type().id() != ID_signedbv && type().id() != ID_unsignedbv))
+  {
+    return shared_from_this();
+  }
+
+  const auto &bv_type = to_integer_bitvector_type(type());
+  const constant_interval_exprt &previous = before_interval->interval;
+
+  exprt lower = interval.get_lower();
+  exprt upper = interval.get_upper();
+  bool widened = false;
+
+  const auto new_upper = numeric_cast<mp_integer>(upper);
+  const auto old_upper = numeric_cast<mp_integer>(previous.get_upper());
+  if(new_upper && old_upper && *new_upper > *old_upper)
+  {
+    const auto t_it = thresholds.lower_bound(*new_upper);
+    if(t_it == thresholds.end() || *t_it > bv_type.largest())
+      upper = max_exprt(type());
+    else
+      upper = from_integer(*t_it, type());
+    widened = true;
+  }
+
+  const auto new_lower = numeric_cast<mp_integer>(lower);
+  const auto old_lower = numeric_cast<mp_integer>(previous.get_lower());
+  if(new_lower && old_lower && *new_lower < *old_lower)
+  {
+    const auto t_it = thresholds.upper_bound(*new_lower);
+    if(t_it == thresholds.begin() || *std::prev(t_it) < bv_type.smallest())
+      lower = min_exprt(type());
+    else
+      lower = from_integer(*std::prev(t_it), type());
+    widened = true;
+  }
+
+  if(!widened)
+    return shared_from_this();
+
+  return std::make_shared<interval_abstract_valuet>(
+    constant_interval_exprt(lower, upper, type()), merge_count);
+}
+
 void interval_abstract_valuet::get_statistics(
   abstract_object_statisticst &statistics,
   abstract_object_visitedt &visited,
@@ -70,6 +70,10 @@ public:
 
   const constant_interval_exprt &get_interval() const;
 
+  abstract_object_pointert widen(
+    const abstract_object_pointert &before,
+    const ai_domain_baset::widening_thresholdst &thresholds) const override;
+
   void get_statistics(
     abstract_object_statisticst &statistics,
     abstract_object_visitedt &visited,
@@ -219,6 +219,22 @@ bool variable_sensitivity_domaint::merge(
   return any_changes;
 }
 
+bool variable_sensitivity_domaint::widen(
+  const variable_sensitivity_domaint &b,
+  locationt from,
+  locationt to,
+  const widening_thresholdst &thresholds)
+{
+  const abstract_environmentt before = abstract_state;
+  if(!merge(b, from, to))
+    return false;
+
+  abstract_state.widen(before, thresholds);
+
+  DATA_INVARIANT(abstract_state.verify(), "Structural invariant");
+  return true;
+}
+
 bool variable_sensitivity_domaint::ai_simplify(
   exprt &condition,
   const namespacet &ns) const
@@ -128,6 +128,21 @@ public:
   virtual bool
   merge(const variable_sensitivity_domaint &b, locationt from, locationt to);
 
+  /// Computes the join between "this" and "b" and widens the values that
+  /// changed, see \ref ai_domain_baset::widening_thresholdst
+  ///
+  /// \param b: the other domain
+  /// \param from: it's preceding location
+  /// \param to: it's current location, a loop head
+  /// \param thresholds: the values to widen bounds to
+  ///
+  /// \return true if something has changed.
+  bool widen(
+    const variable_sensitivity_domaint &b,
+    locationt from,
+    locationt to,
+    const widening_thresholdst &thresholds);
+
   /// Perform a context aware merge of the changes that have been applied
   /// between function_start and the current state. Anything that has not been
   /// modified will be taken from the \p function_call domain.
@@ -79,6 +79,14 @@ void symbol_factoryt::gen_nondet_init(
       }
     }
 
+    if(
+      object_factory_params.lazy_pointer_inputs && subtype.id() != ID_empty &&
+      subtype.id() != ID_array)
+    {
+      gen_lazy_pointer_init(assignments, expr, depth);
+      return;
+    }
+
     code_blockt non_null_inst;
 
     typet object_type = subtype;
@@ -163,6 +171,41 @@ void symbol_factoryt::gen_nondet_init(
   }
 }
 
+void symbol_factoryt::gen_lazy_pointer_init(
+  code_blockt &assignments,
+  const exprt &expr,
+  const std::size_t depth)
+{
+  const pointer_typet &pointer_type = to_pointer_type(expr.type());
+
+  // The object pointed to is left uninitialised. Its name marks it as an auto
+  // object, whose pointers symbolic execution initialises the first time the
+  // object is dereferenced, see goto-symex/auto_objects.cpp.
+  const symbolt &object = get_fresh_aux_symbol(
+    pointer_type.subtype(),
+    id2string(goto_functionst::entry_point()),
+    "auto_object",
+    loc,
+    ID_C,
+    symbol_table);
+
+  const address_of_exprt address_of_object(object.symbol_expr(), pointer_type);
+
+  if(depth < object_factory_params.min_null_tree_depth)
+  {
+    assignments.add(code_assignt{expr, address_of_object, loc});
+  }
+  else
+  {
+    assignments.add(code_assignt{
+      expr,
+      if_exprt{side_effect_expr_nondett(bool_typet(), loc),
+               null_pointer_exprt{pointer_type},
+               address_of_object},
+      loc});
+  }
+}
+
 void symbol_factoryt::gen_nondet_array_init(
   code_blockt &assignments,
   const exprt &expr,
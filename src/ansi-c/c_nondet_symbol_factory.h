@@ -73,6 +73,16 @@ public:
   }
 
 private:
+  /// Make \p expr, which is of pointer type, either null or point to a fresh
+  /// auto object that symbolic execution initialises lazily
+  /// \param assignments: The code block to add code to
+  /// \param expr: An expression of pointer type
+  /// \param depth: Number of pointers followed so far during initialisation
+  void gen_lazy_pointer_init(
+    code_blockt &assignments,
+    const exprt &expr,
+    std::size_t depth);
+
   /// Generate initialisation code for each array element
   /// \param assignments: The code block to add code to
   /// \param expr: An expression of array type
@@ -8,7 +8,20 @@ Author: Daniel Poetzl
 
 #include "c_object_factory_parameters.h"
 
+#include <util/cmdline.h>
+#include <util/options.h>
+
+void c_object_factory_parameterst::set(const optionst &options)
+{
+  object_factory_parameterst::set(options);
+
+  lazy_pointer_inputs = options.get_bool_option("lazy-pointer-inputs");
+}
+
 void parse_c_object_factory_options(const cmdlinet &cmdline, optionst &options)
 {
   parse_object_factory_options(cmdline, options);
+
+  if(cmdline.isset("lazy-pointer-inputs"))
+    options.set_option("lazy-pointer-inputs", true);
 }
@@ -20,7 +20,17 @@ struct c_object_factory_parameterst final : public object_factory_parameterst
   explicit c_object_factory_parameterst(const optionst &options)
     : object_factory_parameterst(options)
   {
+    set(options);
   }
+
+  /// Leave the objects that pointer inputs point to uninitialised auto
+  /// objects, whose pointers symbolic execution initialises when they are
+  /// first dereferenced, rather than allocating the whole object tree up
+  /// front
+  bool lazy_pointer_inputs = false;
+
+  /// Assigns the parameters from given options
+  void set(const optionst &);
 };
 
 /// Parse the c object factory parameters from a given command line
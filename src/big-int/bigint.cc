@@ -277,9 +277,17 @@ digit_div (onedig_t *r, const onedig_t *y, unsigned yl, onedig_t *q, unsigned ql
 inline void
 BigInt::allocate (unsigned digits)
 {
-  size = adjust_size (digits);
   length = 0;
-  digit = new onedig_t[size];
+  if (digits <= local)
+    {
+      size = local;
+      digit = local_digit;
+    }
+  else
+    {
+      size = adjust_size (digits);
+      digit = new onedig_t[size];
+    }
 }
 
 
@@ -291,7 +299,7 @@ BigInt::reallocate (unsigned digits)
 {
   if (digits > size)
     {
-      if (size)
+      if (size && !is_local())
 	delete[] digit;
       size = adjust_size (digits);
       digit = new onedig_t[size];
@@ -313,7 +321,7 @@ BigInt::resize (unsigned digits)
       if (old_digit)
 	{
 	  memcpy (digit, old_digit, length * sizeof (onedig_t));
-	  if (old_size)
+	  if (old_size && old_digit != local_digit)
 	    delete[] old_digit;
 	}
     }
@@ -386,7 +394,7 @@ BigInt::assign (llong_t l)
 
 BigInt::~BigInt()
 {
-  if (size > 0)
+  if (size > 0 && !is_local())
     {
       memset (digit, 0, size * sizeof digit[0]); // Crypto-paranoia.
       delete[] digit;
@@ -401,64 +409,64 @@ BigInt::BigInt (onedig_t *dig, unsigned len, bool pos)
 {}
 
 BigInt::BigInt()
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size]),
+    digit (local_digit),
     positive (true)
 {}
 
 BigInt::BigInt (signed long int n)
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size])
+    digit (local_digit)
 {
   assign (llong_t (n));
 }
 
 BigInt::BigInt (unsigned long int n)
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size])
+    digit (local_digit)
 {
   assign (ullong_t (n));
 }
 
 BigInt::BigInt (int n)
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size])
+    digit (local_digit)
 {
   assign (llong_t (n));
 }
 
 BigInt::BigInt (unsigned u)
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size])
+    digit (local_digit)
 {
   assign (ullong_t (u));
 }
 
 BigInt::BigInt (llong_t l)
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size])
+    digit (local_digit)
 {
   assign (l);
 }
 
 BigInt::BigInt (ullong_t ul)
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size])
+    digit (local_digit)
 {
   assign (ul);
 }
 
 BigInt::BigInt (BigInt const &y)
-  : size (adjust_size (y.length)),
+  : size (y.length <= local ? unsigned (local) : adjust_size (y.length)),
     length (y.length),
-    digit (new onedig_t[size]),
+    digit (y.length <= local ? local_digit : new onedig_t[size]),
     positive (y.positive)
 {
   memcpy (digit, y.digit, length * sizeof (onedig_t));
@@ -471,9 +479,9 @@ BigInt::BigInt (BigInt &&y)
 }
 
 BigInt::BigInt (char const *s, onedig_t b)
-  : size (adjust_size (small)),
+  : size (local),
     length (0),
-    digit (new onedig_t[size]),
+    digit (local_digit),
     positive (true)
 {
   scan (s, b);
@@ -494,6 +502,36 @@ BigInt::operator= (BigInt &&y)
   return *this;
 }
 
+void
+BigInt::swap (BigInt &other)
+{
+  if (!is_local() && !other.is_local())
+    {
+      std::swap (other.size, size);
+      std::swap (other.digit, digit);
+    }
+  else if (is_local() && other.is_local())
+    {
+      for (unsigned i = 0; i < local; ++i)
+	std::swap (local_digit[i], other.local_digit[i]);
+    }
+  else
+    {
+      // Exactly one of the digit vectors is local: move its digits
+      // into the local vector of the other object, which hands over
+      // its heap vector (or external digits) in return.
+      BigInt &l = is_local() ? *this : other;
+      BigInt &h = is_local() ? other : *this;
+      memcpy (h.local_digit, l.local_digit, l.length * sizeof (onedig_t));
+      l.digit = h.digit;
+      l.size = h.size;
+      h.digit = h.local_digit;
+      h.size = local;
+    }
+  std::swap (other.length, length);
+  std::swap (other.positive, positive);
+}
+
 
 char const *
 BigInt::scan_on (char const *s, onedig_t b)
@@ -872,10 +910,12 @@ BigInt::mul (onedig_t const *dig, unsigned len, bool pos)
     }
   else
     {
-      // Get a new string of digits for the result.
-      unsigned old_size = size;
-      size = adjust_size (length + len);
-      onedig_t *r = new onedig_t[size];
+      // Get a new string of digits for the result. Small products are
+      // formed in a temporary and then copied back to this.
+      const unsigned r_length = length + len;
+      onedig_t local_r[local];
+      onedig_t *r =
+	r_length <= local ? local_r : new onedig_t[adjust_size (r_length)];
 
       // The first parameter pair defines the outer loop which should
       // be the shorter.
@@ -885,10 +925,24 @@ BigInt::mul (onedig_t const *dig, unsigned len, bool pos)
 	digit_mul (dig, len, digit, length, r);
 
       // Replace digit string of this with result.
-      if (old_size)
-	delete[] digit;
-      digit = r;
-      length += len;
+      if (r == local_r)
+	{
+	  if (size < r_length)
+	    {
+	      // Only external digits (size 0) can be that small.
+	      digit = local_digit;
+	      size = local;
+	    }
+	  memcpy (digit, local_r, r_length * sizeof (onedig_t));
+	}
+      else
+	{
+	  if (size && !is_local())
+	    delete[] digit;
+	  digit = r;
+	  size = adjust_size (r_length);
+	}
+      length = r_length;
       adjust();
     }
 
@@ -1092,7 +1146,7 @@ BigInt::div (BigInt const &x, BigInt const &y, BigInt &q, BigInt &r)
       onedig_t *b = (onedig_t *)alloca (bl * sizeof (onedig_t));
       memcpy (b, y.digit, bl * sizeof (onedig_t));
 
-      onedig_t scale = onedig_t (base / (1 + b[bl - 1]));
+      onedig_t scale = onedig_t (base / (1 + twodig_t (b[bl - 1])));
       if (scale != 1)
 	{
 	  if ((a[al] = digit_mul (a, al, scale)) != 0) ++al;
@@ -1175,7 +1229,7 @@ BigInt::operator/= (BigInt const &y)
       onedig_t *b = (onedig_t *)alloca (bl * sizeof (onedig_t));
       memcpy (b, y.digit, bl * sizeof (onedig_t));
 
-      onedig_t scale = onedig_t (base / (1 + b[bl - 1]));
+      onedig_t scale = onedig_t (base / (1 + twodig_t (b[bl - 1])));
       if (scale != 1)
 	{
 	  if ((a[al] = digit_mul (a, al, scale)) != 0) ++al;
@@ -1244,7 +1298,7 @@ BigInt::operator%= (BigInt const &y)
       onedig_t *b = (onedig_t *)alloca (bl * sizeof (onedig_t));
       memcpy (b, y.digit, bl * sizeof (onedig_t));
 
-      onedig_t scale = onedig_t (base / (1 + b[bl - 1]));
+      onedig_t scale = onedig_t (base / (1 + twodig_t (b[bl - 1])));
       if (scale != 1)
 	{
 	  if ((a[al] = digit_mul (a, al, scale)) != 0) ++al;
@@ -128,11 +128,21 @@ public:
   // by an elementary type.
   enum { small = sizeof (ullong_t) / sizeof (onedig_t) };
 
+  // Number of digits stored within the object itself. Values of up to
+  // twice the width of ullong_t, which covers products of elementary
+  // types, do not allocate a digit vector on the heap.
+  // Not part of original BigInt.
+  enum { local = 2 * small };
+
 private:
   unsigned size;			// Length of digit vector.
   unsigned length;			// Used places in digit vector.
   onedig_t *digit;			// Least significant first.
   bool positive;			// Signed magnitude representation.
+  onedig_t local_digit[local];		// Digit vector for small values.
+
+  // Whether digit points to local_digit rather than to the heap.
+  bool is_local() const			{ return digit == local_digit; }
 
   // Create or resize this.
   inline void allocate (unsigned digits);
@@ -281,13 +291,7 @@ public:
   // Not part of original BigInt.
   void setPower2 (unsigned exponent) _fast;
 
-  void swap (BigInt &other)
-  {
-    std::swap(other.size, size);
-    std::swap(other.length, length);
-    std::swap(other.digit, digit);
-    std::swap(other.positive, positive);
-  }
+  void swap (BigInt &other) _fast;
 };
 
 
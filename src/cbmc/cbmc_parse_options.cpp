@@ -11,10 +11,15 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "cbmc_parse_options.h"
 
+#include <algorithm>
 #include <fstream>
 #include <cstdlib> // exit()
 #include <iostream>
+#include <list>
+#include <map>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <util/config.h>
 #include <util/exception_utils.h>
@@ -42,7 +47,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-checker/multi_path_symex_checker.h>
 #include <goto-checker/multi_path_symex_only_checker.h>
 #include <goto-checker/properties.h>
+#include <goto-checker/report_util.h>
 #include <goto-checker/single_loop_incremental_symex_checker.h>
+#include <goto-checker/single_loop_k_induction_checker.h>
 #include <goto-checker/single_path_symex_checker.h>
 #include <goto-checker/single_path_symex_only_checker.h>
 #include <goto-checker/stop_on_fail_verifier.h>
@@ -50,6 +57,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <goto-programs/add_malloc_may_fail_variable_initializations.h>
 #include <goto-programs/adjust_float_expressions.h>
+#include <goto-programs/goto_function_passes.h>
 #include <goto-programs/initialize_goto_model.h>
 #include <goto-programs/instrument_preconditions.h>
 #include <goto-programs/link_to_library.h>
@@ -170,6 +178,12 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("no-array-field-sensitivity", true);
   }
 
+  if(cmdline.isset("max-auto-objects"))
+  {
+    options.set_option(
+      "max-auto-objects", cmdline.get_value("max-auto-objects"));
+  }
+
   if(cmdline.isset("partial-loops") && cmdline.isset("unwinding-assertions"))
   {
     log.error()
@@ -190,6 +204,23 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("full-slice"))
     options.set_option("full-slice", true);
 
+  if(cmdline.isset("full-slice-per-function"))
+  {
+    if(
+      cmdline.isset("stop-on-fail") || cmdline.isset("paths") ||
+      cmdline.isset("cover") || cmdline.isset("incremental-loop") ||
+      cmdline.isset("localize-faults") || cmdline.isset("checkpoint") ||
+      cmdline.isset("resume") || cmdline.isset("stream-results"))
+    {
+      log.error() << "--full-slice-per-function cannot be used with "
+                  << "--stop-on-fail, --paths, --cover, --incremental-loop, "
+                  << "--localize-faults, --checkpoint, --resume or "
+                  << "--stream-results" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+    options.set_option("full-slice-per-function", true);
+  }
+
   if(cmdline.isset("show-symex-strategies"))
   {
     log.status() << show_path_strategies() << messaget::eom;
@@ -272,15 +303,49 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(
     cmdline.isset("trace") || cmdline.isset("compact-trace") ||
     cmdline.isset("stack-trace") || cmdline.isset("stop-on-fail") ||
+    cmdline.isset("stream-results") ||
     (ui_message_handler.get_ui() != ui_message_handlert::uit::PLAIN &&
      !cmdline.isset("cover")))
   {
     options.set_option("trace", true);
   }
 
+  if(cmdline.isset("stream-results"))
+  {
+    // only the verifiers that check all properties and store their traces
+    // can output the results as they are found
+    if(
+      options.get_bool_option("stop-on-fail") || cmdline.isset("cover") ||
+      cmdline.isset("localize-faults"))
+    {
+      log.error() << "--stream-results cannot be used with --stop-on-fail, "
+                  << "--cover or --localize-faults" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+    options.set_option("stream-results", true);
+  }
+
   if(cmdline.isset("localize-faults"))
     options.set_option("localize-faults", true);
 
+  if(cmdline.isset("checkpoint") || cmdline.isset("resume"))
+  {
+    if(
+      options.get_bool_option("stop-on-fail") ||
+      options.get_bool_option("localize-faults") || cmdline.isset("cover"))
+    {
+      log.error() << "--checkpoint and --resume cannot be used with "
+                  << "--stop-on-fail, --localize-faults or --cover"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("checkpoint"))
+      options.set_option("checkpoint", cmdline.get_value("checkpoint"));
+    if(cmdline.isset("resume"))
+      options.set_option("resume", cmdline.get_value("resume"));
+  }
+
   if(cmdline.isset("unwind"))
     options.set_option("unwind", cmdline.get_value("unwind"));
 
@@ -337,6 +402,24 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("slice-formula"))
     options.set_option("slice-formula", true);
 
+  if(cmdline.isset("stream-ssa"))
+  {
+    if(
+      cmdline.isset("slice-formula") || cmdline.isset("paths") ||
+      cmdline.isset("incremental-loop"))
+    {
+      log.error() << "--stream-ssa must not be given together with "
+                  << "--slice-formula, --paths or --incremental-loop"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    // steps are converted before the equation is complete, hence they can
+    // no longer be sliced away
+    options.set_option("stream-ssa", true);
+    options.set_option("simple-slice", false);
+  }
+
   // simplify if conditions and branches
   if(cmdline.isset("no-simplify-if"))
     options.set_option("simplify-if", false);
@@ -398,6 +481,18 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     if(cmdline.isset("ignore-properties-before-unwind-min"))
       options.set_option("ignore-properties-before-unwind-min", true);
 
+    if(cmdline.isset("k-induction"))
+    {
+      if(cmdline.isset("unwind-min"))
+      {
+        log.error() << "--unwind-min not supported with --k-induction"
+                    << messaget::eom;
+        exit(CPROVER_EXIT_USAGE_ERROR);
+      }
+
+      options.set_option("k-induction", true);
+    }
+
     if(cmdline.isset("paths"))
     {
       log.error() << "--paths not supported with --incremental-loop"
@@ -525,6 +620,12 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("show-goto-symex-steps"))
     options.set_option("show-goto-symex-steps", true);
 
+  if(cmdline.isset("hash-consing"))
+    options.set_option("hash-consing", true);
+
+  if(cmdline.isset("function-summaries"))
+    options.set_option("function-summaries", true);
+
   if(cmdline.isset("show-points-to-sets"))
     options.set_option("show-points-to-sets", true);
 
@@ -732,9 +833,29 @@ int cbmc_parse_optionst::doit()
     return CPROVER_EXIT_SUCCESS;
   }
 
+  if(options.get_bool_option("full-slice-per-function"))
+    return check_properties_per_function(options);
+
   std::unique_ptr<goto_verifiert> verifier = nullptr;
 
-  if(options.is_set("incremental-loop"))
+  if(
+    options.is_set("incremental-loop") &&
+    options.get_bool_option("k-induction"))
+  {
+    if(options.get_bool_option("stop-on-fail"))
+    {
+      verifier = util_make_unique<
+        stop_on_fail_verifiert<single_loop_k_induction_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+    else
+    {
+      verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
+        single_loop_k_induction_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+  }
+  else if(options.is_set("incremental-loop"))
   {
     if(options.get_bool_option("stop-on-fail"))
     {
@@ -809,6 +930,105 @@ int cbmc_parse_optionst::doit()
   return result_to_exit_code(result);
 }
 
+int cbmc_parse_optionst::check_properties_per_function(const optionst &options)
+{
+  propertiest properties = initialize_properties(goto_model);
+
+  // the property identifiers of each function, and the instructions of the
+  // goto model by location number, to relate the properties that symex adds,
+  // such as unwinding assertions, to the goto model
+  std::map<irep_idt, std::list<std::string>> function_properties;
+  std::unordered_map<unsigned, goto_programt::const_targett> instructions;
+  for(const auto &function_pair : goto_model.goto_functions.function_map)
+  {
+    const goto_programt &body = function_pair.second.body;
+    for(auto it = body.instructions.begin(); it != body.instructions.end();
+        ++it)
+    {
+      instructions.emplace(it->location_number, it);
+      if(it->is_assert())
+      {
+        function_properties[function_pair.first].push_back(
+          id2string(it->source_location.get_property_id()));
+      }
+    }
+  }
+
+  std::unordered_set<irep_idt> checked_properties;
+  const bool output_traces = options.get_bool_option("trace");
+  std::size_t iterations = 0;
+
+  for(const auto &function_pair : function_properties)
+  {
+    log.status() << "Checking the properties of " << function_pair.first
+                 << " on a full slice" << messaget::eom;
+
+    // the instructions that are sliced away are left in place as skips,
+    // such that the location numbers and loop identifiers of the remaining
+    // instructions are the same as in the goto model
+    goto_modelt sliced_model;
+    sliced_model.symbol_table = goto_model.symbol_table;
+    sliced_model.goto_functions.copy_from(goto_model.goto_functions);
+    property_slicer(sliced_model, function_pair.second, false);
+
+    all_properties_verifier_with_trace_storaget<multi_path_symex_checkert>
+      verifier(options, ui_message_handler, sliced_model);
+    (void)verifier();
+    iterations += verifier.get_iterations();
+
+    for(const auto &property_pair : verifier.get_properties())
+    {
+      const property_infot &sliced_info = property_pair.second;
+      const auto instruction_it =
+        instructions.find(sliced_info.pc->location_number);
+      CHECK_RETURN(instruction_it != instructions.end());
+
+      auto emplace_result = properties.emplace(
+        property_pair.first,
+        property_infot{instruction_it->second,
+                       sliced_info.description,
+                       property_statust::NOT_CHECKED});
+      property_statust &status = emplace_result.first->second.status;
+
+      // properties of other functions have been sliced away, and properties
+      // added by symex are combined over all slices
+      if(
+        !emplace_result.second &&
+        sliced_info.pc->is_assert() &&
+        std::find(
+          function_pair.second.begin(),
+          function_pair.second.end(),
+          id2string(property_pair.first)) == function_pair.second.end())
+      {
+        continue;
+      }
+
+      if(checked_properties.insert(property_pair.first).second)
+        status = sliced_info.status;
+      else
+        status &= sliced_info.status;
+
+      if(output_traces && sliced_info.status == property_statust::FAIL)
+      {
+        const goto_trace_storaget &traces = verifier.get_traces();
+        output_property_with_trace(
+          property_pair.first,
+          sliced_info,
+          traces[property_pair.first],
+          traces.get_namespace(),
+          trace_optionst(options),
+          ui_message_handler);
+      }
+    }
+  }
+
+  output_properties(properties, iterations, ui_message_handler);
+  const resultt result = determine_result(properties);
+  output_overall_result(result, ui_message_handler);
+
+  return result_to_exit_code(result);
+}
+
 bool cbmc_parse_optionst::set_properties()
 {
   if(cmdline.isset("claim")) // will go away
@@ -939,18 +1159,35 @@ bool cbmc_parse_optionst::process_goto_program(
   // instrument library preconditions
   instrument_preconditions(goto_model);
 
-  // remove returns, gcc vectors, complex
+  // remove returns
   remove_returns(goto_model);
-  remove_vector(goto_model);
-  remove_complex(goto_model);
-  rewrite_union(goto_model);
+
+  // remove gcc vectors, complex and unions, visiting each function once
+  remove_vector(goto_model.symbol_table);
+  remove_complex(goto_model.symbol_table);
+  goto_function_passest lowering_passes;
+  lowering_passes.add([](const irep_idt &, goto_functiont &goto_function) {
+    remove_vector(goto_function);
+  });
+  lowering_passes.add([](const irep_idt &, goto_functiont &goto_function) {
+    remove_complex(goto_function);
+  });
+  lowering_passes.add([](const irep_idt &, goto_functiont &goto_function) {
+    rewrite_union(goto_function);
+  });
+  lowering_passes.run(goto_model.goto_functions);
 
   // add generic checks
   log.status() << "Generic Property Instrumentation" << messaget::eom;
-  goto_check(options, goto_model);
+  const namespacet ns(goto_model.symbol_table);
+  goto_function_passest check_passes;
+  check_passes.add(goto_check_pass(ns, options, goto_model.goto_functions));
 
   // checks don't know about adjusted float expressions
-  adjust_float_expressions(goto_model);
+  check_passes.add([&ns](const irep_idt &, goto_functiont &goto_function) {
+    adjust_float_expressions(goto_function, ns);
+  });
+  check_passes.run(goto_model.goto_functions);
 
   // ignore default/user-specified initialization
   // of variables with static lifetime
@@ -1065,8 +1302,16 @@ void cbmc_parse_optionst::help()
     " --symex-coverage-report f    generate a Cobertura XML coverage report in f\n" // NOLINT(*)
     " --property id                only check one specific property\n"
     " --trace                      give a counterexample trace for failed properties\n" //NOLINT(*)
+    " --stream-results             output each failed property and its trace\n"
+    "                              as soon as it is found (implies --trace)\n"
     " --stop-on-fail               stop analysis once a failed property is detected\n" // NOLINT(*)
     "                              (implies --trace)\n"
+    " --checkpoint file            after each round of checks, write the\n"
+    "                              status of the properties decided so far\n"
+    "                              to file\n"
+    " --resume file                take over the properties decided in the\n"
+    "                              checkpoint file, unless it was written for\n"
+    "                              a different program or options\n"
     "\n"
     "C/C++ frontend options:\n"
     " -I path                      set include path (C/C++)\n"
@@ -1129,6 +1374,8 @@ void cbmc_parse_optionst::help()
     HELP_REACHABILITY_SLICER
     HELP_REACHABILITY_SLICER_FB
     " --full-slice                 run full slicer (experimental)\n" // NOLINT(*)
+    " --full-slice-per-function    check the properties of each function on a\n"
+    "                              full slice for these properties only\n"
     " --drop-unused-functions      drop functions trivially unreachable from main function\n" // NOLINT(*)
     " --havoc-undefined-functions\n"
     "                              for any function that has no body, assign non-deterministic values to\n" // NOLINT(*)
@@ -1140,6 +1387,9 @@ void cbmc_parse_optionst::help()
     "\n"
     "BMC options:\n"
     HELP_BMC
+    " --k-induction                also try to prove properties in the body\n"
+    "                              of the incremental-loop for any number of\n"
+    "                              iterations by k-induction\n"
     "\n"
     "Backend options:\n"
     " --object-bits n              number of bits used for object addresses\n"
@@ -42,9 +42,10 @@ class optionst;
 // clang-format off
 #define CBMC_OPTIONS \
   OPT_BMC \
+  "(k-induction)" \
   "(preprocess)(slice-by-trace):" \
   OPT_FUNCTIONS \
-  "(no-simplify)(full-slice)" \
+  "(no-simplify)(full-slice)(full-slice-per-function)" \
   OPT_REACHABILITY_SLICER \
   "(debug-level):(no-propagation)(no-simplify-if)" \
   "(document-subgoals)(outfile):(test-preprocessor)" \
@@ -72,7 +73,8 @@ class optionst;
   "(show-symbol-table)(show-parse-tree)" \
   "(drop-unused-functions)" \
   "(havoc-undefined-functions)" \
-  "(property):(stop-on-fail)(trace)" \
+  "(property):(stop-on-fail)(trace)(stream-results)" \
+  "(checkpoint):(resume):" \
   "(error-label):(verbosity):(no-library)" \
   "(nondet-static)" \
   "(version)" \
@@ -126,6 +128,11 @@ protected:
   void get_command_line_options(optionst &);
   void preprocessing(const optionst &);
   bool set_properties();
+
+  /// Check the properties of each function separately, each time on a full
+  /// slice of the goto model for the properties of that function only
+  /// \return the exit code
+  int check_properties_per_function(const optionst &);
 };
 
 #endif // CPROVER_CBMC_CBMC_PARSE_OPTIONS_H
@@ -293,6 +293,9 @@ void goto_analyzer_parse_optionst::get_command_line_options(optionst &options)
       options.set_option("storage set", true);
     }
 
+    if(cmdline.isset("widening"))
+      options.set_option("widening", true);
+
     // History choice
     if(cmdline.isset("ahistorical"))
     {
@@ -781,6 +784,8 @@ int goto_analyzer_parse_optionst::perform_analysis(const optionst &options)
     try
     {
       analyzer.reset(build_analyzer(options, ns));
+      if(analyzer != nullptr && options.get_bool_option("widening"))
+        analyzer->enable_widening();
     }
     catch(const invalid_command_line_argument_exceptiont &e)
     {
@@ -954,6 +959,8 @@ void goto_analyzer_parse_optionst::help()
     " --legacy-ait                 recursion for function and one domain per location\n"
     // NOLINTNEXTLINE(whitespace/line_length)
     " --legacy-concurrent          legacy-ait with an extended fixed-point for concurrency\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --widening                   widen at loop heads and narrow afterwards (intervals and VSD)\n"
     "\n"
     "History options:\n"
     // NOLINTNEXTLINE(whitespace/line_length)
@@ -38,9 +38,13 @@ public:
 
   resultt operator()() override
   {
+    // failed properties are checked again when their traces are needed
+    resume(goto_model, !options.get_bool_option("trace"));
+
     while(true)
     {
       const auto result = incremental_goto_checker(properties);
+      checkpoint();
       if(result.progress == incremental_goto_checkert::resultt::progresst::DONE)
         break;
 
@@ -52,9 +56,23 @@ public:
         {
           if(properties.at(property_id).status == property_statust::FAIL)
           {
-            // get correctly truncated error trace for property and store it
-            (void)traces.insert(
-              incremental_goto_checker.build_trace(property_id));
+            // get correctly truncated error trace for property and store it,
+            // or output it right away when streaming the results
+            if(options.get_bool_option("stream-results"))
+            {
+              output_property_with_trace(
+                property_id,
+                properties.at(property_id),
+                incremental_goto_checker.build_trace(property_id),
+                incremental_goto_checker.get_namespace(),
+                trace_optionst(options),
+                ui_message_handler);
+            }
+            else
+            {
+              (void)traces.insert(
+                incremental_goto_checker.build_trace(property_id));
+            }
           }
         }
       }
@@ -67,7 +85,10 @@ public:
 
   void report() override
   {
-    if(options.get_bool_option("trace"))
+    // traces that have been streamed are not stored for the final report
+    if(
+      options.get_bool_option("trace") &&
+      !options.get_bool_option("stream-results"))
     {
       const trace_optionst trace_options(options);
       output_properties_with_traces(
@@ -86,6 +107,12 @@ public:
     return traces;
   }
 
+  /// Returns the number of times the incremental goto checker was run
+  std::size_t get_iterations() const
+  {
+    return iterations;
+  }
+
 protected:
   abstract_goto_modelt &goto_model;
   incremental_goto_checkerT incremental_goto_checker;
@@ -261,6 +261,12 @@ void update_properties_status_from_symex_target_equation(
     else
     {
       property_infot &property_info = emplace_result.first->second;
+
+      // properties decided before, for example in an earlier path or in the
+      // run a checkpoint was taken from, keep their status
+      if(!is_property_to_check(property_info.status))
+        continue;
+
       property_statust old_status = property_info.status;
       property_info.status |= status;
 
@@ -179,6 +179,9 @@ void run_property_decider(
   "(show-goto-symex-steps)" \
   "(show-points-to-sets)" \
   "(slice-formula)" \
+  "(hash-consing)" \
+  "(function-summaries)" \
+  "(stream-ssa)" \
   "(unwinding-assertions)" \
   "(no-unwinding-assertions)" \
   "(no-pretty-names)" \
@@ -190,6 +193,7 @@ void run_property_decider(
   "(unwind):" \
   "(max-field-sensitivity-array-size):" \
   "(no-array-field-sensitivity)" \
+  "(max-auto-objects):" \
   "(graphml-witness):" \
   "(unwindset):" \
   "(symex-complexity-limit):" \
@@ -219,6 +223,10 @@ void run_property_decider(
   "this is\n" \
   "                              equivalent to setting the maximum field \n" \
   "                              sensitivity size for arrays to 0\n" \
+  " --max-auto-objects N         materialise at most N objects for pointers\n" \
+  "                              initialised on first dereference; these\n" \
+  "                              pointers may also alias objects of the\n" \
+  "                              same type materialised before\n" \
   " --unwind nr                  unwind nr times\n" \
   " --unwindset L:B,...          unwind loop L with a bound of B\n" \
   "                              (use --show-loops to get the loop IDs)\n" \
@@ -237,6 +245,15 @@ void run_property_decider(
   "                              when using incremental-loop\n" \
   " --show-vcc                   show the verification conditions\n" \
   " --slice-formula              remove assignments unrelated to property\n" \
+  " --hash-consing               share structurally equal expressions built\n" \
+  "                              during symbolic execution\n" \
+  " --function-summaries         execute calls to functions that compute\n" \
+  "                              their return value in straight-line code\n" \
+  "                              from their parameters by instantiating a\n" \
+  "                              summary rather than executing the body\n" \
+  " --stream-ssa                 convert the equation into the solver while\n" \
+  "                              symbolic execution proceeds (cannot be\n" \
+  "                              used with --slice-formula or --paths)\n" \
   " --unwinding-assertions       generate unwinding assertions (cannot be\n" \
   "                              used with --cover or --partial-loops)\n" \
   " --partial-loops              permit paths with partial loops\n" \
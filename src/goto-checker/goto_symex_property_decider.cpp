@@ -104,6 +104,37 @@ decision_proceduret::resultt goto_symex_property_decidert::solve()
   return solver->decision_procedure()();
 }
 
+decision_proceduret::resultt goto_symex_property_decidert::solve_assuming_goals(
+  std::function<bool(const irep_idt &)> select_property)
+{
+  exprt::operandst disjuncts;
+
+  for(const auto &goal_pair : goal_map)
+  {
+    if(
+      select_property(goal_pair.first) &&
+      !goal_pair.second.condition.is_false())
+    {
+      disjuncts.push_back(goal_pair.second.condition);
+    }
+  }
+
+  stack_decision_proceduret &stack_decision_procedure =
+    solver->stack_decision_procedure();
+  const exprt goals = stack_decision_procedure.handle(disjunction(disjuncts));
+
+  if(goals.is_false())
+    return decision_proceduret::resultt::D_UNSATISFIABLE;
+  else if(goals.is_true())
+    return stack_decision_procedure();
+
+  stack_decision_procedure.push({goals});
+  const auto dec_result = stack_decision_procedure();
+  stack_decision_procedure.pop();
+
+  return dec_result;
+}
+
 decision_proceduret &
 goto_symex_property_decidert::get_decision_procedure() const
 {
@@ -44,6 +44,13 @@ public:
   /// Calls solve() on the solver instance
   decision_proceduret::resultt solve();
 
+  /// Calls solve() on the solver instance under the assumption that one of
+  /// the selected properties is violated. Unlike
+  /// \ref add_constraint_from_goals, the assumption is dropped afterwards,
+  /// such that later calls can select properties that are not selected now.
+  decision_proceduret::resultt solve_assuming_goals(
+    std::function<bool(const irep_idt &property_id)> select_property);
+
   /// Returns the solver instance
   decision_proceduret &get_decision_procedure() const;
 
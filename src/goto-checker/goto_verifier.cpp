@@ -11,6 +11,15 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "goto_verifier.h"
 
+#include <util/exception_utils.h>
+#include <util/file_util.h>
+#include <util/irep_hash.h>
+#include <util/string_hash.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
 goto_verifiert::goto_verifiert(
   const optionst &_options,
   ui_message_handlert &ui_message_handler)
@@ -19,3 +28,120 @@ goto_verifiert::goto_verifiert(
     log(ui_message_handler)
 {
 }
+
+/// Hash \p irep, including the names of its identifiers rather than their
+/// numbers, which depend on the order in which strings were interned
+static std::size_t stable_hash(const irept &irep)
+{
+  std::size_t result = hash_string(id2string(irep.id()));
+
+  for(const auto &sub : irep.get_sub())
+    result = hash_combine(result, stable_hash(sub));
+
+  for(const auto &named_sub : irep.get_named_sub())
+  {
+    if(irept::is_comment(named_sub.first))
+      continue;
+
+    result = hash_combine(result, hash_string(id2string(named_sub.first)));
+    result = hash_combine(result, stable_hash(named_sub.second));
+  }
+
+  return result;
+}
+
+/// Compute a fingerprint of the instructions of \p goto_model and of the
+/// \p options that may affect the status of properties
+static std::string compute_checkpoint_fingerprint(
+  const abstract_goto_modelt &goto_model,
+  const optionst &options)
+{
+  std::size_t result = 0;
+
+  for(const auto &function_pair : goto_model.get_goto_functions().function_map)
+  {
+    result = hash_combine(result, hash_string(id2string(function_pair.first)));
+
+    for(const auto &instruction : function_pair.second.body.instructions)
+    {
+      result = hash_combine(result, std::size_t(instruction.type));
+      result = hash_combine(result, stable_hash(instruction.code));
+      result = hash_combine(result, stable_hash(instruction.guard));
+      for(const auto &target : instruction.targets)
+        result = hash_combine(result, std::size_t(target->location_number));
+    }
+  }
+
+  // these options only concern the output or the checkpoints themselves
+  optionst result_options = options;
+  for(const char *option :
+      {"checkpoint", "resume", "trace", "stream-results", "xml-ui", "json-ui"})
+  {
+    result_options.set_option(option, false);
+  }
+
+  std::ostringstream options_stream;
+  result_options.output(options_stream);
+  result = hash_combine(result, hash_string(options_stream.str()));
+
+  std::ostringstream fingerprint;
+  fingerprint << std::hex << result;
+  return fingerprint.str();
+}
+
+void goto_verifiert::resume(
+  const abstract_goto_modelt &goto_model,
+  bool take_over_failures)
+{
+  if(!options.is_set("checkpoint") && !options.is_set("resume"))
+    return;
+
+  checkpoint_fingerprint = compute_checkpoint_fingerprint(goto_model, options);
+
+  if(!options.is_set("resume"))
+    return;
+
+  const std::string file_name = options.get_option("resume");
+  std::ifstream in(file_name);
+  if(!in)
+    throw system_exceptiont("failed to open checkpoint " + file_name);
+
+  if(!read_checkpoint(
+       in, checkpoint_fingerprint, properties, take_over_failures))
+  {
+    log.warning() << "Ignoring checkpoint " << file_name
+                  << ", which was written for a different program or with "
+                  << "different options" << messaget::eom;
+    return;
+  }
+
+  const auto decided = std::count_if(
+    properties.begin(),
+    properties.end(),
+    [](const propertiest::value_type &property_pair) {
+      return !is_property_to_check(property_pair.second.status);
+    });
+  log.status() << "Resuming with " << decided << " properties decided"
+               << messaget::eom;
+}
+
+void goto_verifiert::checkpoint() const
+{
+  if(!options.is_set("checkpoint"))
+    return;
+
+  // write a temporary file first, such that a run that is killed while
+  // writing does not leave a truncated checkpoint behind
+  const std::string file_name = options.get_option("checkpoint");
+  const std::string temporary_file_name = file_name + ".tmp";
+
+  {
+    std::ofstream out(temporary_file_name);
+    write_checkpoint(out, checkpoint_fingerprint, properties);
+    if(!out)
+      throw system_exceptiont("failed to write checkpoint " + file_name);
+  }
+
+  // unlike std::rename, this also replaces an existing checkpoint on Windows
+  file_rename(temporary_file_name, file_name);
+}
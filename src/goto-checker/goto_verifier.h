@@ -49,10 +49,28 @@ public:
 protected:
   goto_verifiert(const optionst &, ui_message_handlert &);
 
+  /// Take over the status of the properties decided in the checkpoint file
+  /// given by the option `resume`, if any, unless it was written for a
+  /// different program or with different options
+  /// \param goto_model: The program that the properties belong to
+  /// \param take_over_failures: Whether failed properties are taken over
+  ///   too, which is only possible if their traces are not needed
+  void
+  resume(const abstract_goto_modelt &goto_model, bool take_over_failures);
+
+  /// Write the status of the properties decided so far to the checkpoint
+  /// file given by the option `checkpoint`, if any. Must be preceded by a
+  /// call of \ref resume.
+  void checkpoint() const;
+
   const optionst &options;
   ui_message_handlert &ui_message_handler;
   messaget log;
   propertiest properties;
+
+  /// Identifies the program and the options in checkpoints, set by
+  /// \ref resume
+  std::string checkpoint_fingerprint;
 };
 
 #endif // CPROVER_GOTO_CHECKER_GOTO_VERIFIER_H
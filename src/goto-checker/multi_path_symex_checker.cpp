@@ -11,7 +11,12 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "multi_path_symex_checker.h"
 
+#include <algorithm>
 #include <chrono>
+#include <map>
+#include <unordered_set>
+
+#include <analyses/cfg_dominators.h>
 
 #include <solvers/hardness_collector.h>
 
@@ -27,6 +32,9 @@ multi_path_symex_checkert::multi_path_symex_checkert(
     equation_generated(false),
     property_decider(options, ui_message_handler, equation, ns)
 {
+  if(options.get_bool_option("stream-ssa"))
+    symex.streaming_decision_procedure =
+      &property_decider.get_decision_procedure();
 }
 
 incremental_goto_checkert::resultt multi_path_symex_checkert::
@@ -60,6 +68,9 @@ operator()(propertiest &properties)
 
     solver_runtime += prepare_property_decider(properties);
 
+    if(options.get_bool_option("cover-batching"))
+      compute_goal_dominators(properties);
+
     equation_generated = true;
   }
 
@@ -71,10 +82,31 @@ operator()(propertiest &properties)
 std::chrono::duration<double>
 multi_path_symex_checkert::prepare_property_decider(propertiest &properties)
 {
-  std::chrono::duration<double> solver_runtime = ::prepare_property_decider(
-    properties, equation, property_decider, ui_message_handler);
+  if(!symex.streaming_decision_procedure)
+  {
+    std::chrono::duration<double> solver_runtime = ::prepare_property_decider(
+      properties, equation, property_decider, ui_message_handler);
+
+    return solver_runtime;
+  }
+
+  // Most of the equation has been converted during symex already; convert
+  // the remaining steps, such as those added by the memory model, and the
+  // assertions.
+  const auto solver_start = std::chrono::steady_clock::now();
+
+  log.status() << "converting remaining SSA steps" << messaget::eom;
+  decision_proceduret &decision_procedure =
+    property_decider.get_decision_procedure();
+  equation.convert_new_steps(decision_procedure);
+  equation.convert_assertions(decision_procedure);
 
-  return solver_runtime;
+  property_decider.update_properties_goals_from_symex_target_equation(
+    properties);
+  property_decider.convert_goals();
+
+  const auto solver_stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(solver_stop - solver_start);
 }
 
 void multi_path_symex_checkert::run_property_decider(
@@ -82,10 +114,147 @@ void multi_path_symex_checkert::run_property_decider(
   propertiest &properties,
   std::chrono::duration<double> solver_runtime)
 {
+  if(options.get_bool_option("cover-batching"))
+  {
+    run_property_decider_by_dominance(result, properties, solver_runtime);
+    return;
+  }
+
   ::run_property_decider(
     result, properties, property_decider, ui_message_handler, solver_runtime);
 }
 
+void multi_path_symex_checkert::compute_goal_dominators(
+  const propertiest &properties)
+{
+  for(const auto &function_pair : goto_model.get_goto_functions().function_map)
+  {
+    const goto_programt &body = function_pair.second.body;
+
+    std::map<goto_programt::const_targett, std::vector<irep_idt>> goals;
+    forall_goto_program_instructions(it, body)
+    {
+      if(!it->is_assert())
+        continue;
+
+      const irep_idt &property_id = it->source_location.get_property_id();
+      if(properties.find(property_id) != properties.end())
+        goals[it].push_back(property_id);
+    }
+
+    if(goals.empty())
+      continue;
+
+    cfg_dominatorst dominators;
+    dominators(body);
+
+    for(const auto &goals_at_location : goals)
+    {
+      for(const auto &dominator :
+          dominators.get_node(goals_at_location.first).dominators)
+      {
+        // goals at the same location do not imply each other
+        if(dominator == goals_at_location.first)
+          continue;
+
+        const auto dominating_goals = goals.find(dominator);
+        if(dominating_goals == goals.end())
+          continue;
+
+        for(const auto &property_id : goals_at_location.second)
+        {
+          auto &entry = goal_dominators[property_id];
+          entry.insert(
+            entry.end(),
+            dominating_goals->second.begin(),
+            dominating_goals->second.end());
+        }
+      }
+    }
+  }
+}
+
+void multi_path_symex_checkert::run_property_decider_by_dominance(
+  incremental_goto_checkert::resultt &result,
+  propertiest &properties,
+  std::chrono::duration<double> solver_runtime)
+{
+  const auto solver_start = std::chrono::steady_clock::now();
+
+  log.status()
+    << "Running "
+    << property_decider.get_decision_procedure().decision_procedure_text()
+    << messaget::eom;
+
+  const auto is_unknown = [&properties](const irep_idt &property_id) {
+    return properties.at(property_id).status == property_statust::UNKNOWN;
+  };
+
+  // The goals of the properties that are still to be checked have the
+  // status UNKNOWN.
+  while(std::any_of(
+    properties.begin(),
+    properties.end(),
+    [&is_unknown](const propertiest::value_type &property_pair) {
+      return is_unknown(property_pair.first);
+    }))
+  {
+    // Goals that are dominated by another uncovered goal are left out of
+    // the query: a test that covers the latter usually covers them as well.
+    std::unordered_set<irep_idt> dominating_goals;
+    for(const auto &property_pair : properties)
+    {
+      if(!is_unknown(property_pair.first))
+        continue;
+
+      const auto entry = goal_dominators.find(property_pair.first);
+      if(entry == goal_dominators.end())
+        continue;
+
+      for(const auto &property_id : entry->second)
+      {
+        if(is_unknown(property_id))
+          dominating_goals.insert(property_id);
+      }
+    }
+
+    const auto is_selected = [&](const irep_idt &property_id) {
+      return is_unknown(property_id) &&
+             dominating_goals.find(property_id) == dominating_goals.end();
+    };
+
+    const decision_proceduret::resultt dec_result =
+      property_decider.solve_assuming_goals(is_selected);
+
+    if(dec_result != decision_proceduret::resultt::D_UNSATISFIABLE)
+    {
+      property_decider.update_properties_status_from_goals(
+        properties, result.updated_properties, dec_result, false);
+
+      if(dec_result == decision_proceduret::resultt::D_SATISFIABLE)
+        result.progress = resultt::progresst::FOUND_FAIL;
+
+      break;
+    }
+
+    // None of the selected goals can be covered; the goals dominating them
+    // are tried in the next round.
+    for(auto &property_pair : properties)
+    {
+      if(is_selected(property_pair.first))
+      {
+        property_pair.second.status |= property_statust::PASS;
+        result.updated_properties.insert(property_pair.first);
+      }
+    }
+  }
+
+  const auto solver_stop = std::chrono::steady_clock::now();
+  solver_runtime += std::chrono::duration<double>(solver_stop - solver_start);
+  log.status() << "Runtime decision procedure: " << solver_runtime.count()
+               << "s" << messaget::eom;
+}
+
 goto_tracet multi_path_symex_checkert::build_full_trace() const
 {
   goto_tracet goto_trace;
@@ -13,6 +13,8 @@ Author: Daniel Kroening, Peter Schrammel
 #define CPROVER_GOTO_CHECKER_MULTI_PATH_SYMEX_CHECKER_H
 
 #include <chrono>
+#include <unordered_map>
+#include <vector>
 
 #include "fault_localization_provider.h"
 #include "goto_symex_property_decider.h"
@@ -76,6 +78,20 @@ protected:
     incremental_goto_checkert::resultt &result,
     propertiest &properties,
     std::chrono::duration<double> solver_runtime);
+
+  /// For each property, the properties in the same function whose location
+  /// dominates its location. Covering a goal usually covers the goals that
+  /// dominate it, so with the option `cover-batching` the solver is first
+  /// asked to cover the goals that do not dominate another uncovered goal.
+  std::unordered_map<irep_idt, std::vector<irep_idt>> goal_dominators;
+
+  void compute_goal_dominators(const propertiest &properties);
+
+  /// Variant of \ref run_property_decider for the option `cover-batching`
+  void run_property_decider_by_dominance(
+    incremental_goto_checkert::resultt &result,
+    propertiest &properties,
+    std::chrono::duration<double> solver_runtime);
 };
 
 #endif // CPROVER_GOTO_CHECKER_MULTI_PATH_SYMEX_CHECKER_H
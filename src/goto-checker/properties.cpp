@@ -11,12 +11,20 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "properties.h"
 
+#include <util/exception_utils.h>
 #include <util/exit_codes.h>
 #include <util/invariant.h>
 #include <util/json.h>
 #include <util/json_stream.h>
+#include <util/prefix.h>
 #include <util/xml.h>
 
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+
 std::string as_string(resultt result)
 {
   switch(result)
@@ -181,6 +189,121 @@ bool has_properties_to_check(const propertiest &properties)
   return false;
 }
 
+static const char checkpoint_header[] = "CBMC checkpoint ";
+
+/// Escape the separators of the fields of a checkpoint line in \p field
+static std::string escape_checkpoint_field(const std::string &field)
+{
+  std::string result;
+  for(const char ch : field)
+  {
+    if(ch == '\\')
+      result += "\\\\";
+    else if(ch == '\t')
+      result += "\\t";
+    else if(ch == '\n')
+      result += "\\n";
+    else
+      result += ch;
+  }
+  return result;
+}
+
+/// Split a checkpoint line into its fields, undoing
+/// \ref escape_checkpoint_field
+static std::vector<std::string> split_checkpoint_line(const std::string &line)
+{
+  std::vector<std::string> fields(1);
+  for(std::size_t i = 0; i < line.size(); ++i)
+  {
+    if(line[i] == '\t')
+      fields.emplace_back();
+    else if(line[i] != '\\')
+      fields.back() += line[i];
+    else if(i + 1 == line.size())
+      throw deserialization_exceptiont("malformed checkpoint line: " + line);
+    else
+    {
+      ++i;
+      fields.back() += line[i] == 't' ? '\t' : line[i] == 'n' ? '\n' : line[i];
+    }
+  }
+  return fields;
+}
+
+void write_checkpoint(
+  std::ostream &out,
+  const std::string &fingerprint,
+  const propertiest &properties)
+{
+  out << checkpoint_header << fingerprint << '\n';
+
+  for(const auto &property_pair : properties)
+  {
+    if(!is_property_to_check(property_pair.second.status))
+    {
+      out << escape_checkpoint_field(id2string(property_pair.first)) << '\t'
+          << as_string(property_pair.second.status) << '\t'
+          << escape_checkpoint_field(
+               property_pair.second.pc->source_location.as_string())
+          << '\t' << escape_checkpoint_field(property_pair.second.description)
+          << '\n';
+    }
+  }
+}
+
+bool read_checkpoint(
+  std::istream &in,
+  const std::string &fingerprint,
+  propertiest &properties,
+  bool take_over_failures)
+{
+  const property_statust decided_statuses[] = {property_statust::NOT_REACHABLE,
+                                               property_statust::PASS,
+                                               property_statust::FAIL,
+                                               property_statust::ERROR};
+
+  std::string line;
+  if(!std::getline(in, line) || !has_prefix(line, checkpoint_header))
+    throw deserialization_exceptiont("not a checkpoint");
+
+  if(line.substr(strlen(checkpoint_header)) != fingerprint)
+    return false;
+
+  while(std::getline(in, line))
+  {
+    const std::vector<std::string> fields = split_checkpoint_line(line);
+    if(fields.size() != 4)
+      throw deserialization_exceptiont("malformed checkpoint line: " + line);
+
+    const std::string &status_string = fields[1];
+    const auto status_it = std::find_if(
+      std::begin(decided_statuses),
+      std::end(decided_statuses),
+      [&status_string](property_statust status) {
+        return as_string(status) == status_string;
+      });
+    if(status_it == std::end(decided_statuses))
+      throw deserialization_exceptiont("unknown property status: " + line);
+
+    // the property might have changed even though the program as a whole
+    // is the same, e.g. when only line numbers shifted
+    auto property_it = properties.find(fields[0]);
+    if(
+      property_it == properties.end() ||
+      property_it->second.pc->source_location.as_string() != fields[2] ||
+      property_it->second.description != fields[3] ||
+      (*status_it == property_statust::FAIL && !take_over_failures))
+    {
+      continue;
+    }
+
+    property_it->second.status = *status_it;
+  }
+
+  return true;
+}
+
 /// Update with the preference order
 /// 1. old non-UNKNOWN/non-NOT_CHECKED status
 /// 2. new non-UNKNOWN/non-NOT_CHECKED status
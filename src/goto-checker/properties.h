@@ -12,6 +12,7 @@ Author: Daniel Kroening, Peter Schrammel
 #ifndef CPROVER_GOTO_CHECKER_PROPERTIES_H
 #define CPROVER_GOTO_CHECKER_PROPERTIES_H
 
+#include <iosfwd>
 #include <unordered_map>
 
 #include <goto-programs/goto_model.h>
@@ -104,6 +105,37 @@ bool is_property_to_check(property_statust);
 /// Return true if there as a property with NOT_CHECKED or UNKNOWN status
 bool has_properties_to_check(const propertiest &properties);
 
+/// Write the status of the properties that have been decided to \p out,
+/// one property per line together with its location and description, such
+/// that a later run can take them over using \ref read_checkpoint
+/// \param out: Stream to write to
+/// \param fingerprint: Identifies the program and the options that the
+///   properties were checked with
+/// \param properties: The properties to write
+void write_checkpoint(
+  std::ostream &out,
+  const std::string &fingerprint,
+  const propertiest &properties);
+
+/// Set the status of the properties in \p properties to the status recorded
+/// for them in the checkpoint read from \p in. Nothing is taken over if the
+/// checkpoint was written with a different \p fingerprint. Recorded
+/// properties that do not occur in \p properties, such as those only added
+/// during symbolic execution, or whose location or description differ, are
+/// ignored.
+/// \param in: Stream written by \ref write_checkpoint
+/// \param fingerprint: Identifies the program and the options of this run
+/// \param [out] properties: The properties to update
+/// \param take_over_failures: Whether failed properties are taken over too;
+///   their traces are not part of the checkpoint
+/// \return false if the checkpoint was written with a different fingerprint
+/// \throws deserialization_exceptiont if \p in is not a checkpoint
+bool read_checkpoint(
+  std::istream &in,
+  const std::string &fingerprint,
+  propertiest &properties,
+  bool take_over_failures);
+
 property_statust &operator|=(property_statust &, property_statust const &);
 property_statust &operator&=(property_statust &, property_statust const &);
 resultt determine_result(const propertiest &properties);
@@ -37,6 +37,17 @@ void output_properties_with_traces(
   std::size_t iterations,
   ui_message_handlert &ui_message_handler);
 
+/// Output the result of a single property and, if it failed, its trace,
+/// as soon as the property has been decided rather than in the final report.
+/// In JSON each property is output in a result object of its own.
+void output_property_with_trace(
+  const irep_idt &property_id,
+  const property_infot &property_info,
+  const goto_tracet &goto_trace,
+  const namespacet &ns,
+  const trace_optionst &trace_options,
+  ui_message_handlert &ui_message_handler);
+
 void output_properties_with_fault_localization(
   const propertiest &properties,
   const std::unordered_map<irep_idt, fault_location_infot> &,
@@ -76,6 +76,7 @@ operator()(propertiest &properties)
   {
     full_equation_generated = !symex.from_entry_point_of(
       goto_symext::get_goto_function(goto_model), symex_symbol_table);
+    ++symex_runs;
 
     // This might add new properties such as unwinding assertions, for instance.
     update_properties_status_from_symex_target_equation(
@@ -155,6 +156,10 @@ operator()(propertiest &properties)
       property_decider.get_stack_decision_procedure().pop();
     }
 
+    prove_for_all_unwindings(properties, result.updated_properties);
+    if(!has_properties_to_check(properties))
+      break;
+
     // Now we are finally done.
     if(full_equation_generated)
     {
@@ -174,6 +179,7 @@ operator()(propertiest &properties)
     // We continue symbolic execution
     full_equation_generated =
       !symex.resume(goto_symext::get_goto_function(goto_model));
+    ++symex_runs;
     revert_slice(equation);
 
     // This might add new properties such as unwinding assertions, for instance.
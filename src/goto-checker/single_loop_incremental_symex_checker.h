@@ -60,6 +60,19 @@ protected:
   bool full_equation_generated = false;
   bool current_equation_converted = false;
   goto_symex_property_decidert property_decider;
+
+  /// Number of times symbolic execution has been run, which is the number of
+  /// unwindings of the loop whose properties have been checked so far
+  std::size_t symex_runs = 0;
+
+  /// Called once the properties have been checked for the current unwinding
+  /// and none has been found to fail. Derived classes may try to prove
+  /// properties for any number of unwindings, which need then not be checked
+  /// again. Does nothing by default.
+  virtual void
+  prove_for_all_unwindings(propertiest &, std::unordered_set<irep_idt> &)
+  {
+  }
 };
 
 #endif // CPROVER_GOTO_CHECKER_SINGLE_LOOP_INCREMENTAL_SYMEX_CHECKER_H
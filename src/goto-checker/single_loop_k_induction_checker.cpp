@@ -0,0 +1,474 @@
+/*******************************************************************\
+
+Module: Goto Checker using k-Induction with Incremental Unwinding
+        of a specified Loop
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using k-induction with incremental unwinding of a specified
+/// loop
+
+#include "single_loop_k_induction_checker.h"
+
+#include <util/byte_operators.h>
+#include <util/expr_util.h>
+#include <util/std_code.h>
+
+#include <solvers/prop/prop_conv_solver.h>
+
+#include <set>
+
+#include "bmc_util.h"
+
+single_loop_k_induction_checkert::single_loop_k_induction_checkert(
+  const optionst &options,
+  ui_message_handlert &ui_message_handler,
+  abstract_goto_modelt &goto_model)
+  : single_loop_incremental_symex_checkert(
+      options,
+      ui_message_handler,
+      goto_model),
+    step_case_ns(goto_model.get_symbol_table(), step_case_symbol_table),
+    step_case_equation(ui_message_handler),
+    step_case_symex(
+      ui_message_handler,
+      goto_model.get_symbol_table(),
+      step_case_equation,
+      options,
+      step_case_path_storage,
+      step_case_guard_manager,
+      ui_message_handler.get_ui()),
+    step_case_property_decider(
+      options,
+      ui_message_handler,
+      step_case_equation,
+      step_case_ns),
+    step_case_assumptions(true_exprt())
+{
+  setup_symex(step_case_symex, step_case_ns, options, ui_message_handler);
+
+  prop_conv_solvert *prop_conv_solver = dynamic_cast<prop_conv_solvert *>(
+    &step_case_property_decider.get_stack_decision_procedure());
+  if(prop_conv_solver != nullptr)
+    prop_conv_solver->set_all_frozen();
+
+  step_case_enabled = build_step_case();
+}
+
+/// The object that an assignment to \p lhs writes to, which is a symbol
+/// unless the assignment writes through a pointer
+static const exprt &root_object(const exprt &lhs)
+{
+  const exprt *p = &lhs;
+
+  while(true)
+  {
+    if(p->id() == ID_member)
+      p = &to_member_expr(*p).compound();
+    else if(p->id() == ID_index)
+      p = &to_index_expr(*p).array();
+    else if(p->id() == ID_typecast)
+      p = &to_typecast_expr(*p).op();
+    else if(
+      p->id() == ID_byte_extract_little_endian ||
+      p->id() == ID_byte_extract_big_endian)
+    {
+      p = &to_byte_extract_expr(*p).op();
+    }
+    else
+      break;
+  }
+
+  return *p;
+}
+
+/// Collect the symbols whose address is taken in \p expr
+static void
+collect_address_taken(const exprt &expr, std::set<irep_idt> &address_taken)
+{
+  expr.visit_pre([&address_taken](const exprt &e) {
+    if(e.id() == ID_address_of)
+    {
+      const exprt &root = root_object(to_address_of_expr(e).object());
+      if(root.id() == ID_symbol)
+        address_taken.insert(to_symbol_expr(root).get_identifier());
+    }
+  });
+}
+
+/// Whether \p expr allocates memory dynamically
+static bool has_allocation(const exprt &expr)
+{
+  return has_subexpr(expr, [](const exprt &e) {
+    return e.id() == ID_side_effect &&
+           to_side_effect_expr(e).get_statement() == ID_allocate;
+  });
+}
+
+bool single_loop_k_induction_checkert::build_step_case()
+{
+  const irep_idt &loop_id = options.get_option("incremental-loop");
+  const goto_functionst &goto_functions = goto_model.get_goto_functions();
+
+  // find the jump back to the head of the loop
+  goto_programt::const_targett original_back_edge;
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    forall_goto_program_instructions(it, gf_entry.second.body)
+    {
+      if(
+        it->is_backwards_goto() &&
+        goto_programt::loop_id(gf_entry.first, *it) == loop_id)
+      {
+        loop_function_id = gf_entry.first;
+        original_back_edge = it;
+      }
+    }
+  }
+
+  if(loop_function_id.empty())
+  {
+    log.warning() << "k-induction: loop " << loop_id << " not found"
+                  << messaget::eom;
+    return false;
+  }
+
+  // The step case must enter the loop exactly once, and each pause of
+  // symbolic execution must be the end of an iteration.
+  if(!original_back_edge->get_condition().is_true())
+  {
+    log.warning() << "k-induction: loop " << loop_id
+                  << " does not end in an unconditional jump" << messaget::eom;
+    return false;
+  }
+
+  if(original_back_edge->get_target() == original_back_edge)
+  {
+    log.warning() << "k-induction: loop " << loop_id << " has an empty body"
+                  << messaget::eom;
+    return false;
+  }
+
+  const unsigned head_number =
+    original_back_edge->get_target()->location_number;
+  const unsigned back_edge_number = original_back_edge->location_number;
+  const goto_programt &original_body =
+    goto_functions.function_map.at(loop_function_id).body;
+
+  forall_goto_program_instructions(it, original_body)
+  {
+    if(!it->is_backwards_goto() || it == original_back_edge)
+      continue;
+
+    const unsigned target_number = it->get_target()->location_number;
+    const unsigned number = it->location_number;
+    if(
+      (target_number < head_number && number >= back_edge_number) ||
+      (target_number <= head_number && number > back_edge_number))
+    {
+      log.warning() << "k-induction: loop " << loop_id
+                    << " is nested in another loop" << messaget::eom;
+      return false;
+    }
+  }
+
+  std::size_t call_sites = 0;
+  bool called_from_entry_point = false;
+  bool allocates = false;
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    forall_goto_program_instructions(it, gf_entry.second.body)
+    {
+      if(
+        it->is_function_call() &&
+        it->get_function_call().function().id() == ID_symbol &&
+        to_symbol_expr(it->get_function_call().function()).get_identifier() ==
+          loop_function_id)
+      {
+        ++call_sites;
+        called_from_entry_point =
+          gf_entry.first == goto_functionst::entry_point();
+      }
+
+      allocates |= has_allocation(it->code) ||
+                   has_allocation(it->get_condition());
+    }
+  }
+
+  if(
+    loop_function_id != goto_functionst::entry_point() &&
+    (call_sites != 1 || !called_from_entry_point))
+  {
+    log.warning() << "k-induction: " << loop_function_id
+                  << " is not called exactly once from the entry point"
+                  << messaget::eom;
+    return false;
+  }
+
+  // collect what the loop may modify
+  std::set<irep_idt> modified;
+  std::set<irep_idt> declared;
+  bool may_modify_unnamed_objects = false;
+
+  for(goto_programt::const_targett it = original_back_edge->get_target();
+      it != original_back_edge;
+      ++it)
+  {
+    if(it->is_decl())
+      declared.insert(it->get_decl().get_identifier());
+    else if(it->is_other())
+    {
+      // e.g. array_set, array_copy or havoc_object, which may write to
+      // objects that are not named in their code
+      may_modify_unnamed_objects = true;
+    }
+    else if(it->is_assign() || it->is_function_call())
+    {
+      if(it->is_function_call())
+        may_modify_unnamed_objects = true;
+
+      const exprt &lhs = it->is_assign() ? it->get_assign().lhs()
+                                         : it->get_function_call().lhs();
+      if(lhs.is_nil())
+        continue;
+
+      const exprt &root = root_object(lhs);
+      if(root.id() == ID_symbol)
+        modified.insert(to_symbol_expr(root).get_identifier());
+      else
+        may_modify_unnamed_objects = true;
+    }
+  }
+
+  if(may_modify_unnamed_objects)
+  {
+    if(allocates)
+    {
+      log.warning() << "k-induction: loop " << loop_id
+                    << " may modify dynamically allocated objects"
+                    << messaget::eom;
+      return false;
+    }
+
+    forall_goto_program_instructions(it, original_body)
+    {
+      collect_address_taken(it->code, modified);
+      collect_address_taken(it->get_condition(), modified);
+    }
+
+    for(const auto &symbol_pair : goto_model.get_symbol_table().symbols)
+    {
+      const symbolt &symbol = symbol_pair.second;
+      if(
+        symbol.is_static_lifetime && symbol.is_lvalue && !symbol.is_type &&
+        !symbol.is_macro && symbol.type.id() != ID_code)
+      {
+        modified.insert(symbol.name);
+      }
+    }
+  }
+
+  // build the step case: havoc the modified objects just before the loop
+  step_case_function.copy_from(
+    goto_functions.function_map.at(loop_function_id));
+  goto_programt &body = step_case_function.body;
+
+  const goto_programt::const_targett original_begin =
+    original_body.instructions.begin();
+  const goto_programt::const_targett original_head =
+    original_back_edge->get_target();
+  auto loop_head = std::next(
+    body.instructions.begin(),
+    std::distance(original_begin, original_head));
+  const auto back_edge = std::next(
+    body.instructions.begin(),
+    std::distance(original_begin, original_back_edge));
+
+  const namespacet ns(goto_model.get_symbol_table());
+  const source_locationt &source_location = loop_head->source_location;
+  goto_programt havoc_code;
+  for(const auto &identifier : modified)
+  {
+    if(declared.find(identifier) != declared.end())
+      continue;
+
+    const symbolt &symbol = ns.lookup(identifier);
+    havoc_code.add(goto_programt::make_assignment(
+      symbol.symbol_expr(),
+      side_effect_expr_nondett(symbol.type, source_location),
+      source_location));
+  }
+
+  // Jumps into the loop from outside now go to the havocking code, while the
+  // jumps back within the loop must still go to its head.
+  const auto havoc_size = havoc_code.instructions.size();
+  const auto havoc_begin = loop_head;
+  body.insert_before_swap(loop_head, havoc_code);
+  loop_head = std::next(havoc_begin, havoc_size);
+  for(auto it = loop_head; it != std::next(back_edge); ++it)
+  {
+    if(it->is_goto() && it->get_target() == havoc_begin)
+      it->set_target(loop_head);
+  }
+
+  body.update();
+  loop_head_location = loop_head->location_number;
+  loop_back_edge_location = back_edge->location_number;
+
+  log.status() << "k-induction: havocking " << havoc_size
+               << " objects before loop " << loop_id << messaget::eom;
+
+  return true;
+}
+
+goto_symext::get_goto_functiont
+single_loop_k_induction_checkert::get_step_case_goto_function()
+{
+  return [this](const irep_idt &id) -> const goto_functionst::goto_functiont & {
+    if(id == loop_function_id)
+      return step_case_function;
+    return goto_model.get_goto_function(id);
+  };
+}
+
+void single_loop_k_induction_checkert::extend_step_case()
+{
+  const bool was_empty = step_case_equation.SSA_steps.empty();
+  const auto previous_last = was_empty
+                               ? step_case_equation.SSA_steps.end()
+                               : std::prev(step_case_equation.SSA_steps.end());
+
+  if(iteration_properties.empty())
+  {
+    step_case_equation_generated = !step_case_symex.from_entry_point_of(
+      get_step_case_goto_function(), step_case_symbol_table);
+  }
+  else
+  {
+    step_case_equation_generated =
+      !step_case_symex.resume(get_step_case_goto_function());
+  }
+
+  decision_proceduret &decision_procedure =
+    step_case_property_decider.get_decision_procedure();
+  step_case_equation.convert_new_steps(decision_procedure);
+
+  iteration_properties.emplace_back();
+  auto &properties = iteration_properties.back();
+
+  for(auto it = was_empty ? step_case_equation.SSA_steps.begin()
+                          : std::next(previous_last);
+      it != step_case_equation.SSA_steps.end();
+      ++it)
+  {
+    if(it->ignore)
+      continue;
+
+    if(it->is_assume())
+    {
+      step_case_assumptions = decision_procedure.handle(
+        and_exprt(step_case_assumptions, it->cond_handle));
+    }
+    else if(
+      it->is_assert() && it->source.function_id == loop_function_id &&
+      it->source.pc->location_number >= loop_head_location &&
+      it->source.pc->location_number <= loop_back_edge_location)
+    {
+      properties[it->get_property_id()].push_back(decision_procedure.handle(
+        implies_exprt(step_case_assumptions, it->cond_expr)));
+    }
+  }
+}
+
+void single_loop_k_induction_checkert::prove_for_all_unwindings(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties)
+{
+  if(!step_case_enabled)
+    return;
+
+  // catch up with the base case
+  while(iteration_properties.size() < symex_runs &&
+        !step_case_equation_generated)
+  {
+    extend_step_case();
+  }
+
+  if(iteration_properties.size() != symex_runs)
+    return;
+
+  // The base case has shown that the properties that are still UNKNOWN do
+  // not fail in the iterations 0 to k.
+  const std::size_t k = symex_runs - 1;
+  std::set<irep_idt> to_prove;
+  for(const auto &iteration : iteration_properties)
+  {
+    for(const auto &property : iteration)
+    {
+      const auto property_it = properties.find(property.first);
+      if(
+        property_it != properties.end() &&
+        property_it->second.status == property_statust::UNKNOWN)
+      {
+        to_prove.insert(property.first);
+      }
+    }
+  }
+
+  if(to_prove.empty())
+    return;
+
+  exprt::operandst hypotheses;
+  exprt::operandst violations;
+  for(std::size_t i = 0; i <= k; ++i)
+  {
+    for(const auto &property : iteration_properties[i])
+    {
+      if(to_prove.find(property.first) == to_prove.end())
+        continue;
+
+      if(i < k)
+      {
+        hypotheses.insert(
+          hypotheses.end(), property.second.begin(), property.second.end());
+      }
+      else
+        violations.push_back(not_exprt(conjunction(property.second)));
+    }
+  }
+
+  decision_proceduret &decision_procedure =
+    step_case_property_decider.get_decision_procedure();
+  const exprt step_case = decision_procedure.handle(
+    and_exprt(conjunction(hypotheses), disjunction(violations)));
+
+  bool proved = step_case.is_false();
+  if(!step_case.is_true() && !proved)
+  {
+    log.status() << "k-induction: checking step case for k=" << k
+                 << messaget::eom;
+
+    stack_decision_proceduret &stack_decision_procedure =
+      step_case_property_decider.get_stack_decision_procedure();
+    stack_decision_procedure.push({step_case});
+    proved = step_case_property_decider.solve() ==
+             decision_proceduret::resultt::D_UNSATISFIABLE;
+    stack_decision_procedure.pop();
+  }
+
+  if(!proved)
+    return;
+
+  log.status() << "k-induction: " << to_prove.size()
+               << (to_prove.size() == 1 ? " property" : " properties")
+               << " proved with k=" << k << messaget::eom;
+
+  for(const auto &property_id : to_prove)
+  {
+    properties.at(property_id).status = property_statust::PASS;
+    updated_properties.insert(property_id);
+  }
+}
@@ -0,0 +1,98 @@
+/*******************************************************************\
+
+Module: Goto Checker using k-Induction with Incremental Unwinding
+        of a specified Loop
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using k-induction with incremental unwinding of a specified
+/// loop
+
+#ifndef CPROVER_GOTO_CHECKER_SINGLE_LOOP_K_INDUCTION_CHECKER_H
+#define CPROVER_GOTO_CHECKER_SINGLE_LOOP_K_INDUCTION_CHECKER_H
+
+#include "single_loop_incremental_symex_checker.h"
+
+#include <map>
+#include <vector>
+
+/// Extends the incremental unwinding of a loop by the step case of
+/// k-induction, such that the properties in the body of the loop can be
+/// proved for any number of iterations rather than up to a bound only.
+///
+/// The base case is the incremental bounded model checking performed by
+/// \ref single_loop_incremental_symex_checkert. The step case is a second
+/// incremental symbolic execution of the program, in which the objects that
+/// the loop may modify are havocked just before the loop is entered, such
+/// that the loop starts from an arbitrary state. Once the properties have
+/// been checked for k+1 unwindings, the solver of the step case is asked
+/// whether the properties in the loop body can fail in iteration k when they
+/// held in the iterations 0 to k-1. If they cannot, they hold for any number
+/// of iterations. The solvers of both cases are kept alive: increasing k only
+/// adds the constraints of the new iteration.
+///
+/// The step case is only used if the loop is not nested in another loop,
+/// ends in an unconditional jump back to its head, and is in a function
+/// that is only called once from the entry point. Loops that call functions,
+/// write through pointers or contain other instructions such as array_set
+/// have all objects havocked whose address is taken or that have static
+/// lifetime, and are not supported if the program allocates memory
+/// dynamically.
+class single_loop_k_induction_checkert
+  : public single_loop_incremental_symex_checkert
+{
+public:
+  single_loop_k_induction_checkert(
+    const optionst &options,
+    ui_message_handlert &ui_message_handler,
+    abstract_goto_modelt &goto_model);
+
+protected:
+  /// Copy of the function containing the loop, with the havocking code
+  /// inserted before the loop
+  goto_functiont step_case_function;
+  irep_idt loop_function_id;
+
+  /// Location numbers of the head of the loop and the jump back to it in
+  /// \ref step_case_function
+  unsigned loop_head_location = 0;
+  unsigned loop_back_edge_location = 0;
+
+  bool step_case_enabled = false;
+
+  symbol_tablet step_case_symbol_table;
+  namespacet step_case_ns;
+  symex_target_equationt step_case_equation;
+  path_fifot step_case_path_storage; // should go away
+  guard_managert step_case_guard_manager;
+  symex_bmc_incremental_one_loopt step_case_symex;
+  goto_symex_property_decidert step_case_property_decider;
+  bool step_case_equation_generated = false;
+
+  /// Handle of the conjunction of the assumptions made so far
+  exprt step_case_assumptions;
+
+  /// For each iteration of the loop in the step case, the handles of the
+  /// instances of each property in the loop body that hold
+  std::vector<std::map<irep_idt, exprt::operandst>> iteration_properties;
+
+  /// Build \ref step_case_function for the loop given by the option
+  /// `incremental-loop`
+  /// \return true if the step case can be used for the loop
+  bool build_step_case();
+
+  /// Run symbolic execution of the step case up to the next iteration of the
+  /// loop and add the new constraints to the step case solver
+  void extend_step_case();
+
+  goto_symext::get_goto_functiont get_step_case_goto_function();
+
+  void prove_for_all_unwindings(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties) override;
+};
+
+#endif // CPROVER_GOTO_CHECKER_SINGLE_LOOP_K_INDUCTION_CHECKER_H
@@ -93,6 +93,9 @@ void symex_bmct::symex_step(
     else if(!state.guard.is_false())
       symex_coverage.covered(cur_pc, state.source.pc);
   }
+
+  if(streaming_decision_procedure)
+    target.convert_new_steps(*streaming_decision_procedure);
 }
 
 void symex_bmct::merge_goto(
@@ -22,6 +22,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "symex_coverage.h"
 
+class decision_proceduret;
+
 class symex_bmct : public goto_symext
 {
 public:
@@ -85,6 +87,11 @@ public:
 
   unwindsett unwindset;
 
+  /// If set, the steps recorded in the equation are converted into this
+  /// decision procedure after each step of symbolic execution, see
+  /// \ref symex_target_equationt::convert_new_steps
+  decision_proceduret *streaming_decision_procedure = nullptr;
+
 protected:
   /// Callbacks that may provide an unwind/do-not-unwind decision for a loop
   std::vector<loop_unwind_handlert> loop_unwind_handlers;
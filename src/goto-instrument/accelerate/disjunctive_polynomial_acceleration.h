@@ -13,6 +13,7 @@ Author: Matt Lewis
 #define CPROVER_GOTO_INSTRUMENT_ACCELERATE_DISJUNCTIVE_POLYNOMIAL_ACCELERATION_H
 
 #include <map>
+#include <memory>
 #include <set>
 
 #include <util/symbol_table.h>
@@ -105,6 +106,13 @@ protected:
   expr_sett modified;
   goto_programt fixed;
   std::list<distinguish_valuest> accelerated_paths;
+
+  /// Program used to search for paths that have not been accelerated yet,
+  /// which is kept across searches together with its solver
+  std::unique_ptr<scratch_programt> path_program;
+  /// Number of paths in \ref accelerated_paths that \ref path_program
+  /// already excludes
+  std::size_t excluded_paths = 0;
 };
 
 // NOLINTNEXTLINE(whitespace/line_length)
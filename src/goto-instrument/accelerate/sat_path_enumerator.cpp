@@ -47,14 +47,14 @@ Author: Matt Lewis
 
 bool sat_path_enumeratort::next(patht &path)
 {
-  scratch_programt program{symbol_table, message_handler, guard_manager};
-
-  program.append(fixed);
-  program.append(fixed);
-
-  // Let's make sure that we get a path we have not seen before.
-  for(std::list<distinguish_valuest>::iterator it=accelerated_paths.begin();
-      it!=accelerated_paths.end();
+  // Each path that has been found is excluded from the following queries.
+  // Rather than building and solving a fresh program for every query, the
+  // program is built once and each query only adds the constraints that
+  // exclude the paths found since the previous one.
+  exprt::operandst new_constraints;
+
+  for(auto it = std::next(accelerated_paths.begin(), excluded_paths);
+      it != accelerated_paths.end();
       ++it)
   {
     exprt new_path=false_exprt();
@@ -76,31 +76,56 @@ bool sat_path_enumeratort::next(patht &path)
       new_path.swap(disjunct);
     }
 
-    program.assume(new_path);
+    new_constraints.push_back(new_path);
   }
 
-  program.add(goto_programt::make_assertion(false_exprt()));
+  excluded_paths = accelerated_paths.size();
 
   try
   {
-    if(program.check_sat(guard_manager))
+    bool sat;
+
+    if(!path_program)
+    {
+      path_program = util_make_unique<scratch_programt>(
+        symbol_table, message_handler, guard_manager);
+
+      path_program->append(fixed);
+      path_program->append(fixed);
+
+      for(const auto &constraint : new_constraints)
+        path_program->assume(constraint);
+
+      path_program->add(goto_programt::make_assertion(false_exprt()));
+
+      // Don't slice: the distinguishers must remain constrained for
+      // the queries that follow.
+      sat = path_program->check_sat(false, guard_manager);
+    }
+    else
+    {
+      sat =
+        path_program->check_sat_incremental(conjunction(new_constraints));
+    }
+
+    if(sat)
     {
 #ifdef DEBUG
       std::cout << "Found a path\n";
 #endif
-      build_path(program, path);
-      record_path(program);
+      build_path(*path_program, path);
+      record_path(*path_program);
 
       return true;
     }
   }
   catch(const std::string &s)
   {
-    std::cout << "Error in fitting polynomial SAT check: " << s << '\n';
+    discard_path_program(path_program, excluded_paths, s);
   }
   catch(const char *s)
   {
-    std::cout << "Error in fitting polynomial SAT check: " << s << '\n';
+    discard_path_program(path_program, excluded_paths, s);
   }
 
   return false;
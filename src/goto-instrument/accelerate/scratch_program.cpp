@@ -12,6 +12,7 @@ Author: Matt Lewis
 #include "scratch_program.h"
 
 #include <util/fixedbv.h>
+#include <util/invariant.h>
 
 #include <solvers/decision_procedure.h>
 
@@ -19,9 +20,7 @@ Author: Matt Lewis
 
 #include <goto-programs/remove_skip.h>
 
-#ifdef DEBUG
 #include <iostream>
-#endif
 
 bool scratch_programt::check_sat(bool do_slice, guard_managert &guard_manager)
 {
@@ -54,6 +53,7 @@ bool scratch_programt::check_sat(bool do_slice, guard_managert &guard_manager)
   if(do_slice)
   {
     slice(equation);
+    equation_sliced = true;
   }
 
   if(equation.count_assertions()==0)
@@ -66,6 +66,7 @@ bool scratch_programt::check_sat(bool do_slice, guard_managert &guard_manager)
   }
 
   equation.convert(*checker);
+  equation_converted = true;
 
 #ifdef DEBUG
   std::cout << "Finished symex, invoking decision procedure.\n";
@@ -74,6 +75,21 @@ bool scratch_programt::check_sat(bool do_slice, guard_managert &guard_manager)
   return ((*checker)() == decision_proceduret::resultt::D_SATISFIABLE);
 }
 
+bool scratch_programt::check_sat_incremental(const exprt &constraint)
+{
+  PRECONDITION(symex_state);
+  PRECONDITION(!equation_sliced);
+
+  // Without any assertions the program is unsatisfiable, and adding
+  // constraints does not change that.
+  if(!equation_converted)
+    return false;
+
+  checker->set_to_true(symex_state->rename<L2>(constraint, ns).get());
+
+  return ((*checker)() == decision_proceduret::resultt::D_SATISFIABLE);
+}
+
 exprt scratch_programt::eval(const exprt &e)
 {
   return checker->get(symex_state->rename<L2>(e, ns).get());
@@ -214,3 +230,13 @@ optionst scratch_programt::get_default_options()
   ret.set_option("simplify", true);
   return ret;
 }
+
+void discard_path_program(
+  std::unique_ptr<scratch_programt> &path_program,
+  std::size_t &excluded_paths,
+  const std::string &error)
+{
+  std::cout << "Error in fitting polynomial SAT check: " << error << '\n';
+  path_program.reset();
+  excluded_paths = 0;
+}
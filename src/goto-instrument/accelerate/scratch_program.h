@@ -70,6 +70,14 @@ public:
     return check_sat(true, guard_manager);
   }
 
+  /// Check the program again with the additional \p constraint over the
+  /// values of the program variables at the end of the program. The equation
+  /// and the solver of the previous call of \ref check_sat, which must not
+  /// have sliced the equation, are reused, so that a sequence of queries that
+  /// only add constraints does not repeat symbolic execution and conversion.
+  /// The constraint remains in place for later checks.
+  bool check_sat_incremental(const exprt &constraint);
+
   exprt eval(const exprt &e);
 
   void fix_types();
@@ -91,7 +99,18 @@ protected:
   bv_pointerst satchecker;
   smt2_dect z3;
   decision_proceduret *checker;
+  bool equation_sliced = false;
+  bool equation_converted = false;
   static optionst get_default_options();
 };
 
+/// Report that a search for paths in \p path_program failed with \p error
+/// and discard the program together with its solver. Resetting
+/// \p excluded_paths makes the next search build the program again with
+/// the constraints that exclude all paths found so far.
+void discard_path_program(
+  std::unique_ptr<scratch_programt> &path_program,
+  std::size_t &excluded_paths,
+  const std::string &error);
+
 #endif // CPROVER_GOTO_INSTRUMENT_ACCELERATE_SCRATCH_PROGRAM_H
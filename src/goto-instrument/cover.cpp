@@ -166,6 +166,7 @@ void parse_cover_options(const cmdlinet &cmdline, optionst &options)
     cmdline.isset("cover-traces-must-terminate"));
   options.set_option(
     "cover-failed-assertions", cmdline.isset("cover-failed-assertions"));
+  options.set_option("cover-batching", cmdline.isset("cover-batching"));
 }
 
 /// Build data structures controlling coverage from command-line options.
@@ -24,7 +24,8 @@ class optionst;
 
 #define OPT_COVER                                                              \
   "(cover):"                                                                   \
-  "(cover-failed-assertions)"
+  "(cover-failed-assertions)"                                                  \
+  "(cover-batching)"
 
 #define HELP_COVER                                                             \
   " --cover CC                   create test-suite with coverage criterion "   \
@@ -32,7 +33,10 @@ class optionst;
   " --cover-failed-assertions    do not stop coverage checking at failed "     \
   "assertions\n"                                                               \
   "                              (this is the default for --cover "            \
-  "assertions)\n"
+  "assertions)\n"                                                              \
+  " --cover-batching             first look for tests for the goals that do "  \
+  "not\n"                                                                      \
+  "                              dominate another uncovered goal\n"
 
 enum class coverage_criteriont
 {
@@ -93,7 +93,7 @@ void dott::write_dot_subgraph(
     const namespacet ns(goto_model.symbol_table);
 
     std::set<goto_programt::const_targett> seen;
-    goto_programt::const_targetst worklist;
+    std::list<goto_programt::const_targett> worklist;
     worklist.push_back(instructions.begin());
 
     while(!worklist.empty())
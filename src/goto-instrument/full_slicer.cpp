@@ -339,7 +339,14 @@ void full_slicert::operator()(
     }
 
   // remove the skips
-  remove_skip(goto_functions);
+  if(remove_skips)
+    remove_skip(goto_functions);
+  else
+  {
+    // jumps may have been turned into skips
+    goto_functions.compute_incoming_edges();
+    goto_functions.compute_target_numbers();
+  }
 }
 
 void full_slicer(
@@ -368,18 +375,21 @@ void full_slicer(goto_modelt &goto_model)
 void property_slicer(
   goto_functionst &goto_functions,
   const namespacet &ns,
-  const std::list<std::string> &properties)
+  const std::list<std::string> &properties,
+  bool remove_skips)
 {
   properties_criteriont p(properties);
-  full_slicert()(goto_functions, ns, p);
+  full_slicert slicer(remove_skips);
+  slicer(goto_functions, ns, p);
 }
 
 void property_slicer(
   goto_modelt &goto_model,
-  const std::list<std::string> &properties)
+  const std::list<std::string> &properties,
+  bool remove_skips)
 {
   const namespacet ns(goto_model.symbol_table);
-  property_slicer(goto_model.goto_functions, ns, properties);
+  property_slicer(goto_model.goto_functions, ns, properties, remove_skips);
 }
 
 slicing_criteriont::~slicing_criteriont()
@@ -20,14 +20,21 @@ void full_slicer(
 
 void full_slicer(goto_modelt &);
 
+/// Slice with respect to the assertions with the given \p properties
+/// identifiers. If \p remove_skips is set, the instructions that are not
+/// needed are removed and the locations and loops renumbered. Otherwise they
+/// are left in place as skips, such that the location numbers and loop
+/// identifiers of the remaining instructions stay the same.
 void property_slicer(
   goto_functionst &,
   const namespacet &,
-  const std::list<std::string> &properties);
+  const std::list<std::string> &properties,
+  bool remove_skips = true);
 
 void property_slicer(
   goto_modelt &,
-  const std::list<std::string> &properties);
+  const std::list<std::string> &properties,
+  bool remove_skips = true);
 
 class slicing_criteriont
 {
@@ -38,12 +38,22 @@ echo 'digraph g {' > c.dot ; cat c.goto | \
 class full_slicert
 {
 public:
+  /// \param remove_skips: Whether to remove the instructions that are not
+  ///   needed, which renumbers the locations and loops of the remaining
+  ///   instructions, rather than leaving them in place as skips
+  explicit full_slicert(bool _remove_skips = true)
+    : remove_skips(_remove_skips)
+  {
+  }
+
   void operator()(
     goto_functionst &goto_functions,
     const namespacet &ns,
     const slicing_criteriont &criterion);
 
 protected:
+  const bool remove_skips;
+
   struct cfg_nodet
   {
     cfg_nodet():node_required(false)
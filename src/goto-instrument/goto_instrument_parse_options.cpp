@@ -1483,6 +1483,12 @@ void goto_instrument_parse_optionst::instrument_goto_program()
       const unsigned max_po_trans=
         cmdline.isset("max-po-trans")?
         unsafe_string2unsigned(cmdline.get_value("max-po-trans")):0;
+      const unsigned max_cycles=
+        cmdline.isset("max-cycles")?
+        unsafe_string2unsigned(cmdline.get_value("max-cycles")):0;
+      const unsigned cycles_time_limit=
+        cmdline.isset("cycles-time-limit")?
+        unsafe_string2unsigned(cmdline.get_value("cycles-time-limit")):0;
 
       if(mm=="tso")
       {
@@ -1534,6 +1540,8 @@ void goto_instrument_parse_optionst::instrument_goto_program()
           loops,
           max_var,
           max_po_trans,
+          max_cycles,
+          cycles_time_limit,
           !cmdline.isset("no-po-rendering"),
           cmdline.isset("render-cluster-file"),
           cmdline.isset("render-cluster-function"),
@@ -1848,6 +1856,8 @@ void goto_instrument_parse_optionst::help()
     " --minimum-interference       instruments an optimal number of events\n"
     " --my-events                  only instruments events whose ids appear in inst.evt\n" // NOLINT(*)
     " --cfg-kill                   enables symbolic execution used to reduce spurious cycles\n" // NOLINT(*)
+    " --max-cycles <n>             stops collecting cycles after n cycles\n"
+    " --cycles-time-limit <s>      stops collecting cycles after s seconds\n"
     " --no-dependencies            no dependency analysis\n"
     // NOLINTNEXTLINE(whitespace/line_length)
     " --no-po-rendering            no representation of the threads in the dot\n"
@@ -61,6 +61,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(unwinding-assertions)(partial-loops)(continue-as-loops)" \
   "(log):" \
   "(max-var):(max-po-trans):(ignore-arrays)" \
+  "(max-cycles):(cycles-time-limit):" \
   "(cfg-kill)(no-dependencies)(force-loop-duplication)" \
   "(call-graph)(reachable-call-graph)" \
   OPT_INSERT_FINAL_ASSERT_FALSE \
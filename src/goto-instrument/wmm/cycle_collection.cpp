@@ -82,12 +82,24 @@ void event_grapht::graph_explorert::collect_cycles(
   if(order->empty())
     return;
 
+  if(egraph.cycles_time_limit!=0)
+    deadline=
+      std::chrono::steady_clock::now()+
+      std::chrono::seconds(egraph.cycles_time_limit);
+
+  /* the orders list an event once per outgoing edge, but the exploration
+     from a source does not depend on how often it was started before */
+  std::set<event_idt> explored;
+
   for(std::list<event_idt>::const_iterator
       st_it=order->begin();
-      st_it!=order->end();
+      st_it!=order->end() && !budget_exhausted;
       ++st_it)
   {
     event_idt source=*st_it;
+    if(!explored.insert(source).second)
+      continue;
+
     egraph.message.debug() << "explore " << egraph[source].id << messaget::eom;
     backtrack(
       set_of_cycles,
@@ -109,11 +121,32 @@ void event_grapht::graph_explorert::collect_cycles(
     }
   }
 
+  if(budget_exhausted)
+    egraph.message.warning() << "cycle collection stopped after "
+                             << set_of_cycles.size() << " cycles, "
+                             << "the instrumentation may be incomplete"
+                             << messaget::eom;
+
   /* end of collection -- remove spurious by thin-air cycles */
   if(egraph.filter_thin_air)
     filter_thin_air(set_of_cycles);
 }
 
+/// checks whether the collection has reached its budget of cycles or time
+bool event_grapht::graph_explorert::out_of_budget(
+  const std::set<critical_cyclet> &set_of_cycles)
+{
+  if(!budget_exhausted)
+  {
+    budget_exhausted=
+      (egraph.max_cycles!=0 && set_of_cycles.size()>=egraph.max_cycles) ||
+      (egraph.cycles_time_limit!=0 &&
+       std::chrono::steady_clock::now()>=deadline);
+  }
+
+  return budget_exhausted;
+}
+
 /// extracts a (whole, unreduced) cycle from the stack. Note: it may not be a
 /// real cycle yet -- we cannot check the size before a call to this function.
 event_grapht::critical_cyclet event_grapht::graph_explorert::extract_cycle(
@@ -204,6 +237,9 @@ bool event_grapht::graph_explorert::backtrack(
   if(filtering(vertex))
     return false;
 
+  if(out_of_budget(set_of_cycles))
+    return false;
+
   egraph.message.debug() << "bcktck "<<egraph[vertex].id<<"#"<<vertex<<", "
     <<egraph[source].id<<"#"<<source<<" lw:"<<lwfence_met<<" unsafe:"
     <<unsafe_met << messaget::eom;
@@ -14,6 +14,7 @@ Date: 2012
 #ifndef CPROVER_GOTO_INSTRUMENT_WMM_EVENT_GRAPH_H
 #define CPROVER_GOTO_INSTRUMENT_WMM_EVENT_GRAPH_H
 
+#include <chrono>
 #include <list>
 #include <set>
 #include <map>
@@ -246,6 +247,10 @@ protected:
   unsigned max_po_trans;
   bool ignore_arrays;
 
+  /* budget of each collection of cycles (0: unbounded) */
+  unsigned max_cycles;
+  unsigned cycles_time_limit;
+
   /* graph explorer (for each cycles collection) */
   class graph_explorert
   {
@@ -281,6 +286,12 @@ protected:
     /* number of cycles met so far */
     unsigned cycle_nb;
 
+    /* set once the number of cycles collected or the time spent reaches
+       the budget of the collection, to stop the exploration */
+    bool budget_exhausted;
+    std::chrono::steady_clock::time_point deadline;
+    bool out_of_budget(const std::set<critical_cyclet> &set_of_cycles);
+
     /* events in thin-air executions met so far */
     /* any execution blocked by thin-air is guaranteed
        to have all its events in this set */
@@ -298,7 +309,8 @@ protected:
       egraph(_egraph),
       max_var(_max_var),
       max_po_trans(_max_po_trans),
-      cycle_nb(0)
+      cycle_nb(0),
+      budget_exhausted(false)
     {
     }
 
@@ -384,6 +396,8 @@ public:
     max_var(0),
     max_po_trans(0),
     ignore_arrays(false),
+    max_cycles(0),
+    cycles_time_limit(0),
     filter_thin_air(true),
     filter_uniproc(true),
     message(_message)
@@ -574,6 +588,15 @@ public:
     ignore_arrays = _ignore_arrays;
   }
 
+  /* stops each collection of cycles once it has found _max_cycles cycles or
+     run for _time_limit seconds (0: unbounded); the cycles found so far are
+     then instrumented, which may not be enough to restore SC */
+  void set_collection_budget(unsigned _max_cycles, unsigned _time_limit)
+  {
+    max_cycles = _max_cycles;
+    cycles_time_limit = _time_limit;
+  }
+
   /* collects all the pairs of events with respectively at least one cmp,
      regardless of the architecture (Pensieve'05 strategy) */
   void collect_pairs()
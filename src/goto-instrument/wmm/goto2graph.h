@@ -398,6 +398,11 @@ public:
     egraph.set_parameters_collection(_max_var, _max_po_trans, _ignore_arrays);
   }
 
+  void set_collection_budget(unsigned _max_cycles, unsigned _time_limit)
+  {
+    egraph.set_collection_budget(_max_cycles, _time_limit);
+  }
+
   /* builds the relations between unsafe pairs in the critical cycles and
      instructions to instrument in the code */
 
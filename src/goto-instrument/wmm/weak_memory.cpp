@@ -115,6 +115,8 @@ void weak_memory(
   loop_strategyt duplicate_body,
   unsigned input_max_var,
   unsigned input_max_po_trans,
+  unsigned max_cycles,
+  unsigned cycles_time_limit,
   bool render_po,
   bool render_file,
   bool render_function,
@@ -159,6 +161,8 @@ void weak_memory(
   else
     instrumenter.set_parameters_collection(max_thds, 0, ignore_arrays);
 
+  instrumenter.set_collection_budget(max_cycles, cycles_time_limit);
+
   if(SCC)
   {
     instrumenter.collect_cycles_by_SCCs(model);
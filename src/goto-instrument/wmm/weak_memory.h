@@ -36,6 +36,8 @@ void weak_memory(
   loop_strategyt duplicate_body,
   unsigned max_var,
   unsigned max_po_trans,
+  unsigned max_cycles,
+  unsigned cycles_time_limit,
   bool render_po,
   bool render_file,
   bool render_function,
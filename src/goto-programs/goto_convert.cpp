@@ -339,7 +339,7 @@ void goto_convertt::convert_label(
 
     targets.labels.insert(
       {label, {target, targets.destructor_stack.get_current_node()}});
-    target->labels.push_front(label);
+    target->labels.insert(target->labels.begin(), label);
   }
 }
 
@@ -0,0 +1,23 @@
+/*******************************************************************\
+
+Module: Apply Function-Local Passes in a Single Sweep
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Apply Function-Local Passes in a Single Sweep
+
+#include "goto_function_passes.h"
+
+#include "goto_functions.h"
+
+void goto_function_passest::run(goto_functionst &goto_functions) const
+{
+  for(auto &named_function : goto_functions.function_map)
+  {
+    for(const auto &pass : passes)
+      pass(named_function.first, named_function.second);
+  }
+}
@@ -0,0 +1,50 @@
+/*******************************************************************\
+
+Module: Apply Function-Local Passes in a Single Sweep
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Apply Function-Local Passes in a Single Sweep
+
+#ifndef CPROVER_GOTO_PROGRAMS_GOTO_FUNCTION_PASSES_H
+#define CPROVER_GOTO_PROGRAMS_GOTO_FUNCTION_PASSES_H
+
+#include <functional>
+#include <vector>
+
+#include "goto_function.h"
+
+class goto_functionst;
+
+/// A sequence of transformations that each only read and modify the body of
+/// the function they are applied to. Rather than running each of them over
+/// all functions before starting the next one, \ref run applies all of them
+/// to one function before moving on to the next, such that the instructions
+/// of a function are only brought into memory once. The result is the same as
+/// running the passes one after the other as long as no pass depends on the
+/// result of another pass on a different function, and no pass adds symbols
+/// to the symbol table.
+class goto_function_passest
+{
+public:
+  typedef std::function<void(const irep_idt &, goto_functiont &)> passt;
+
+  /// Append \p pass to the passes to run on each function
+  void add(passt pass)
+  {
+    passes.push_back(std::move(pass));
+  }
+
+  /// Apply the passes, in the order they were added, to each function of
+  /// \p goto_functions in turn. The functions are visited in the order of
+  /// the function map, which is not the lexicographic order of their names.
+  void run(goto_functionst &goto_functions) const;
+
+protected:
+  std::vector<passt> passes;
+};
+
+#endif // CPROVER_GOTO_PROGRAMS_GOTO_FUNCTION_PASSES_H
@@ -11,6 +11,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "goto_inline_class.h"
 
+#include <algorithm>
+
 #ifdef DEBUG
 #include <iostream>
 #endif
@@ -259,7 +261,12 @@ void goto_inlinet::insert_function_body(
   if(goto_function.is_hidden())
   {
     for(auto &instruction : body.instructions)
-      instruction.labels.remove(CPROVER_PREFIX "HIDE");
+    {
+      auto &labels = instruction.labels;
+      labels.erase(
+        std::remove(labels.begin(), labels.end(), CPROVER_PREFIX "HIDE"),
+        labels.end());
+    }
   }
 
   replace_return(body, lhs);
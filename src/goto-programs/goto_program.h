@@ -15,8 +15,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iosfwd>
 #include <set>
 #include <limits>
+#include <list>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <util/invariant.h>
 #include <util/namespace.h>
@@ -299,8 +301,10 @@ public:
     /// The target for gotos and for start_thread nodes
     typedef std::list<instructiont>::iterator targett;
     typedef std::list<instructiont>::const_iterator const_targett;
-    typedef std::list<targett> targetst;
-    typedef std::list<const_targett> const_targetst;
+    // Almost all instructions have at most one target, so a contiguous
+    // vector is much cheaper than a list here.
+    typedef std::vector<targett> targetst;
+    typedef std::vector<const_targett> const_targetst;
 
     /// The list of successor instructions
     targetst targets;
@@ -327,7 +331,7 @@ public:
     }
 
     /// Goto target labels
-    typedef std::list<irep_idt> labelst;
+    typedef std::vector<irep_idt> labelst;
     labelst labels;
 
     // will go away
@@ -484,8 +488,8 @@ public:
 
   typedef instructionst::iterator targett;
   typedef instructionst::const_iterator const_targett;
-  typedef std::list<targett> targetst;
-  typedef std::list<const_targett> const_targetst;
+  typedef std::vector<targett> targetst;
+  typedef std::vector<const_targett> const_targetst;
 
   /// The list of instructions in the goto program
   instructionst instructions;
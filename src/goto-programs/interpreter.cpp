@@ -1059,10 +1059,8 @@ exprt interpretert::get_value(const irep_idt &id)
 /// members, print functions are nonconst
 void interpretert::print_memory(bool input_flags)
 {
-  for(const auto &cell_address : memory)
-  {
-    mp_integer i=cell_address.first;
-    const memory_cellt &cell=cell_address.second;
+  memory.iterate([&](uint64_t address, const memory_cellt &cell) {
+    const mp_integer i = address;
     const auto identifier = address_to_symbol(i).get_identifier();
     const auto offset=address_to_offset(i);
     output.status() << identifier << "[" << offset << "]"
@@ -1071,7 +1069,7 @@ void interpretert::print_memory(bool input_flags)
       output.status() << "(" << static_cast<int>(cell.initialized) << ")"
                       << messaget::eom;
     output.status() << messaget::eom;
-  }
+  });
 }
 
 void interpreter(
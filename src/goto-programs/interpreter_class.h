@@ -110,15 +110,34 @@ protected:
   memory_mapt memory_map;
   inverse_memory_mapt inverse_memory_map;
 
+  /// The object record found most recently, as consecutive accesses are
+  /// usually to the same object. Objects are never removed from
+  /// \ref inverse_memory_map, so the iterator stays valid.
+  mutable optionalt<inverse_memory_mapt::const_iterator> last_object_record;
+
   const inverse_memory_mapt::value_type &address_to_object_record(
     const mp_integer &address) const
   {
-    auto lower_bound=inverse_memory_map.lower_bound(address);
+    if(last_object_record.has_value())
+    {
+      const auto last = *last_object_record;
+      const auto next = std::next(last);
+      if(
+        last->first <= address &&
+        (next == inverse_memory_map.end() || address < next->first))
+      {
+        return *last;
+      }
+    }
+
+    inverse_memory_mapt::const_iterator lower_bound =
+      inverse_memory_map.lower_bound(address);
     if(lower_bound->first!=address)
     {
       CHECK_RETURN(lower_bound!=inverse_memory_map.begin());
       --lower_bound;
     }
+    last_object_record = lower_bound;
     return *lower_bound;
   }
 
@@ -145,17 +164,12 @@ protected:
 
   mp_integer base_address_to_actual_size(const mp_integer &address) const
   {
-    auto memory_iter = memory.find(numeric_cast_v<std::size_t>(address));
-    if(memory_iter==memory.end())
+    const std::size_t begin = numeric_cast_v<std::size_t>(address);
+    if(!memory.is_present(begin))
       return 0;
-    mp_integer ret=0;
-    mp_integer alloc_size=base_address_to_alloc_size(address);
-    while(memory_iter!=memory.end() && memory_iter->first<(address+alloc_size))
-    {
-      ++ret;
-      ++memory_iter;
-    }
-    return ret;
+    const mp_integer alloc_size = base_address_to_alloc_size(address);
+    return memory.count_present(
+      begin, numeric_cast_v<std::size_t>(address + alloc_size));
   }
 
   class memory_cellt
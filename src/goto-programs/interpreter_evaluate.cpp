@@ -96,12 +96,11 @@ void interpretert::allocate(
 /// Clears memoy r/w flag initialization
 void interpretert::clear_input_flags()
 {
-  for(auto &cell : memory)
-  {
-    if(cell.second.initialized==
-       memory_cellt::initializedt::WRITTEN_BEFORE_READ)
-      cell.second.initialized=memory_cellt::initializedt::UNKNOWN;
-  }
+  // the flags are mutable
+  memory.iterate([](uint64_t, const memory_cellt &cell) {
+    if(cell.initialized == memory_cellt::initializedt::WRITTEN_BEFORE_READ)
+      cell.initialized = memory_cellt::initializedt::UNKNOWN;
+  });
 }
 
 /// Count the number of leaf subtypes of `ty`, a leaf type is a type that is
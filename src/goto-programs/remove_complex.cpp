@@ -280,8 +280,7 @@ void remove_complex(symbol_tablet &symbol_table)
 }
 
 /// removes complex data type
-static void remove_complex(
-  goto_functionst::goto_functiont &goto_function)
+void remove_complex(goto_functionst::goto_functiont &goto_function)
 {
   for(auto &i : goto_function.body.instructions)
     i.transform([](exprt e) -> optionalt<exprt> {
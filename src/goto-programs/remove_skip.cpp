@@ -107,7 +107,7 @@ void remove_skip(
       goto_programt::targett old_target=it;
 
       // for collecting labels
-      std::list<irep_idt> labels;
+      goto_programt::instructiont::labelst labels;
 
       while(is_skip(goto_program, it, true))
       {
@@ -122,14 +122,15 @@ void remove_skip(
         }
 
         // save labels
-        labels.splice(labels.end(), it->labels);
+        labels.insert(labels.end(), it->labels.begin(), it->labels.end());
+        it->labels.clear();
         it++;
       }
 
       goto_programt::targett new_target=it;
 
       // save labels
-      it->labels.splice(it->labels.begin(), labels);
+      it->labels.insert(it->labels.begin(), labels.begin(), labels.end());
 
       if(new_target!=old_target)
       {
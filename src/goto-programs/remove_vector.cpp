@@ -208,7 +208,7 @@ static void remove_vector(symbolt &symbol)
 }
 
 /// removes vector data type
-static void remove_vector(symbol_tablet &symbol_table)
+void remove_vector(symbol_tablet &symbol_table)
 {
   for(const auto &named_symbol : symbol_table.symbols)
     remove_vector(symbol_table.get_writeable_ref(named_symbol.first));
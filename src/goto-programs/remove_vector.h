@@ -14,12 +14,21 @@ Date:   September 2014
 #ifndef CPROVER_GOTO_PROGRAMS_REMOVE_VECTOR_H
 #define CPROVER_GOTO_PROGRAMS_REMOVE_VECTOR_H
 
+class goto_functiont;
 class goto_functionst;
 class goto_modelt;
 class symbol_tablet;
 
 void remove_vector(symbol_tablet &, goto_functionst &);
 
+/// Remove the 'vector' data type from the types and values of the symbols in
+/// the symbol table only, to be followed by a call of
+/// \ref remove_vector(goto_functiont &) for each function
+void remove_vector(symbol_tablet &);
+
+/// Remove the 'vector' data type from the body of a single function
+void remove_vector(goto_functiont &);
+
 void remove_vector(goto_modelt &);
 
 #endif // CPROVER_GOTO_PROGRAMS_REMOVE_VECTOR_H
@@ -16,6 +16,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/symbol_table.h>
 #include <util/std_expr.h>
 
+#include <algorithm>
+
 exprt goto_symext::make_auto_object(const typet &type, statet &state)
 {
   dynamic_counter++;
@@ -31,7 +33,9 @@ exprt goto_symext::make_auto_object(const typet &type, statet &state)
 
   state.symbol_table.add(symbol);
 
-  return symbol_exprt(symbol.name, symbol.type);
+  auto_objects.emplace_back(symbol.name, symbol.type);
+
+  return auto_objects.back();
 }
 
 void goto_symext::initialize_auto_object(const exprt &expr, statet &state)
@@ -59,15 +63,38 @@ void goto_symext::initialize_auto_object(const exprt &expr, statet &state)
     if(subtype.id()!=ID_code &&
        subtype.id()!=ID_empty)
     {
+      const std::size_t max_auto_objects = symex_config.max_auto_objects;
+
       // could be NULL nondeterministically
+      exprt rhs = null_pointer_exprt(pointer_type);
 
-      address_of_exprt address_of_expr(
-        make_auto_object(pointer_type.subtype(), state), pointer_type);
+      // or, when the number of auto objects is bounded, point to one that
+      // has been materialised before
+      if(max_auto_objects != 0)
+      {
+        for(const symbol_exprt &object : auto_objects)
+        {
+          if(object.type() == subtype)
+          {
+            rhs = if_exprt(
+              side_effect_expr_nondett(bool_typet(), expr.source_location()),
+              address_of_exprt(object, pointer_type),
+              rhs);
+          }
+        }
+      }
+
+      // or point to a fresh object, unless the bound has been reached
+      if(max_auto_objects == 0 || auto_objects.size() < max_auto_objects)
+      {
+        address_of_exprt address_of_expr(
+          make_auto_object(subtype, state), pointer_type);
 
-      if_exprt rhs(
-        side_effect_expr_nondett(bool_typet(), expr.source_location()),
-        null_pointer_exprt(pointer_type),
-        address_of_expr);
+        rhs = if_exprt(
+          side_effect_expr_nondett(bool_typet(), expr.source_location()),
+          rhs,
+          address_of_expr);
+      }
 
       code_assignt assignment(expr, rhs);
       symex_assign(state, assignment);
@@ -93,6 +120,18 @@ void goto_symext::trigger_auto_object(const exprt &expr, statet &state)
           if(!state.get_level2().current_names.has_key(
                ssa_expr.get_identifier()))
           {
+            // auto objects that were not created by symex, such as the
+            // pointees of the inputs of the entry point, may be aliased too
+            if(
+              symex_config.max_auto_objects != 0 &&
+              std::find(
+                auto_objects.begin(),
+                auto_objects.end(),
+                symbol.symbol_expr()) == auto_objects.end())
+            {
+              auto_objects.push_back(symbol.symbol_expr());
+            }
+
             initialize_auto_object(e, state);
           }
         }
@@ -18,14 +18,48 @@ Author: Daniel Kroening
 #include <util/simplify_expr.h>
 #include <util/threeval.h>
 
+#include <unordered_map>
+
 #include <goto-programs/goto_functions.h>
 
 #include <solvers/decision_procedure.h>
 
 #include "partial_order_concurrency.h"
 
+/// Values of expressions in the satisfying assignment of a decision
+/// procedure. The steps of a trace refer to the same guards, conditions and
+/// array sizes many times, so each of them is only evaluated once.
+class trace_modelt
+{
+public:
+  explicit trace_modelt(const decision_proceduret &decision_procedure)
+    : decision_procedure(decision_procedure)
+  {
+  }
+
+  const exprt &get(const exprt &expr)
+  {
+    auto entry = values.emplace(expr, nil_exprt{});
+    if(entry.second)
+      entry.first->second = decision_procedure.get(expr);
+    return entry.first->second;
+  }
+
+  /// Value of \p expr without keeping it, for expressions that are
+  /// unlikely to be queried again, such as the left-hand sides of
+  /// assignments
+  exprt get_once(const exprt &expr) const
+  {
+    return decision_procedure.get(expr);
+  }
+
+private:
+  const decision_proceduret &decision_procedure;
+  std::unordered_map<exprt, exprt, irep_hash> values;
+};
+
 static exprt build_full_lhs_rec(
-  const decision_proceduret &decision_procedure,
+  trace_modelt &model,
   const namespacet &ns,
   const exprt &src_original, // original identifiers
   const exprt &src_ssa)      // renamed identifiers
@@ -38,7 +72,7 @@ static exprt build_full_lhs_rec(
   if(id==ID_index)
   {
     // get index value from src_ssa
-    exprt index_value = decision_procedure.get(to_index_expr(src_ssa).index());
+    exprt index_value = model.get(to_index_expr(src_ssa).index());
 
     if(index_value.is_not_nil())
     {
@@ -46,7 +80,7 @@ static exprt build_full_lhs_rec(
       index_exprt tmp=to_index_expr(src_original);
       tmp.index()=index_value;
       tmp.array() = build_full_lhs_rec(
-        decision_procedure,
+        model,
         ns,
         to_index_expr(src_original).array(),
         to_index_expr(src_ssa).array());
@@ -59,7 +93,7 @@ static exprt build_full_lhs_rec(
   {
     member_exprt tmp=to_member_expr(src_original);
     tmp.struct_op() = build_full_lhs_rec(
-      decision_procedure,
+      model,
       ns,
       to_member_expr(src_original).struct_op(),
       to_member_expr(src_ssa).struct_op());
@@ -69,18 +103,18 @@ static exprt build_full_lhs_rec(
     if_exprt tmp2=to_if_expr(src_original);
 
     tmp2.false_case() = build_full_lhs_rec(
-      decision_procedure,
+      model,
       ns,
       tmp2.false_case(),
       to_if_expr(src_ssa).false_case());
 
     tmp2.true_case() = build_full_lhs_rec(
-      decision_procedure,
+      model,
       ns,
       tmp2.true_case(),
       to_if_expr(src_ssa).true_case());
 
-    exprt tmp = decision_procedure.get(to_if_expr(src_ssa).cond());
+    const exprt &tmp = model.get(to_if_expr(src_ssa).cond());
 
     if(tmp.is_true())
       return tmp2.true_case();
@@ -93,7 +127,7 @@ static exprt build_full_lhs_rec(
   {
     typecast_exprt tmp=to_typecast_expr(src_original);
     tmp.op() = build_full_lhs_rec(
-      decision_procedure,
+      model,
       ns,
       to_typecast_expr(src_original).op(),
       to_typecast_expr(src_ssa).op());
@@ -104,7 +138,7 @@ static exprt build_full_lhs_rec(
   {
     byte_extract_exprt tmp = to_byte_extract_expr(src_original);
     tmp.op() = build_full_lhs_rec(
-      decision_procedure, ns, tmp.op(), to_byte_extract_expr(src_ssa).op());
+      model, ns, tmp.op(), to_byte_extract_expr(src_ssa).op());
 
     // re-write into big case-split
   }
@@ -178,27 +212,25 @@ static void update_internal_field(
 }
 
 /// Replace nondet values that appear in \p type by their values as found by
-/// \p solver.
-static void
-replace_nondet_in_type(typet &type, const decision_proceduret &solver)
+/// \p model.
+static void replace_nondet_in_type(typet &type, trace_modelt &model)
 {
   if(type.id() == ID_array)
   {
     array_typet &array_type = to_array_type(type);
-    array_type.size() = solver.get(array_type.size());
+    array_type.size() = model.get(array_type.size());
   }
   if(type.has_subtype())
-    replace_nondet_in_type(type.subtype(), solver);
+    replace_nondet_in_type(type.subtype(), model);
 }
 
 /// Replace nondet values that appear in the type of \p expr and its
-/// subexpressions type by their values as found by \p solver.
-static void
-replace_nondet_in_type(exprt &expr, const decision_proceduret &solver)
+/// subexpressions type by their values as found by \p model.
+static void replace_nondet_in_type(exprt &expr, trace_modelt &model)
 {
-  replace_nondet_in_type(expr.type(), solver);
+  replace_nondet_in_type(expr.type(), model);
   for(auto &sub : expr.operands())
-    replace_nondet_in_type(sub, solver);
+    replace_nondet_in_type(sub, model);
 }
 
 void build_goto_trace(
@@ -216,6 +248,8 @@ void build_goto_trace(
   typedef std::map<mp_integer, std::vector<ssa_step_iteratort>> time_mapt;
   time_mapt time_map;
 
+  trace_modelt model(decision_procedure);
+
   mp_integer current_time=0;
 
   ssa_step_iteratort last_step_to_keep = target.SSA_steps.end();
@@ -237,7 +271,7 @@ void build_goto_trace(
 
     const SSA_stept &SSA_step = *it;
 
-    if(!decision_procedure.get(SSA_step.guard_handle).is_true())
+    if(!model.get(SSA_step.guard_handle).is_true())
       continue;
 
     if(it->is_constraint() ||
@@ -262,7 +296,7 @@ void build_goto_trace(
         // these are just used to get the time stamp -- the clock type is
         // computed to be of the minimal necessary size, but we don't need to
         // know it to get the value so just use typeless
-        exprt clock_value = decision_procedure.get(
+        exprt clock_value = model.get_once(
           symbol_exprt::typeless(partial_order_concurrencyt::rw_clock_id(it)));
 
         const auto cv = numeric_cast<mp_integer>(clock_value);
@@ -315,6 +349,12 @@ void build_goto_trace(
     }
 
     time_map[current_time].push_back(it);
+
+    // All further steps have a time of at least zero and, within the same
+    // time, come after the last step to keep: none of them will be part of
+    // the trace.
+    if(last_step_was_kept && current_time == 0)
+      break;
   }
 
   INVARIANT(
@@ -354,7 +394,7 @@ void build_goto_trace(
       goto_trace_step.function_arguments = SSA_step.converted_function_arguments;
 
       for(auto &arg : goto_trace_step.function_arguments)
-        arg = decision_procedure.get(arg);
+        arg = model.get(arg);
 
       // update internal field for specific variables in the counterexample
       update_internal_field(SSA_step, goto_trace_step, ns);
@@ -372,21 +412,17 @@ void build_goto_trace(
       {
         goto_trace_step.full_lhs = simplify_expr(
           build_full_lhs_rec(
-            decision_procedure,
-            ns,
-            SSA_step.original_full_lhs,
-            SSA_step.ssa_full_lhs),
+            model, ns, SSA_step.original_full_lhs, SSA_step.ssa_full_lhs),
           ns);
-        replace_nondet_in_type(goto_trace_step.full_lhs, decision_procedure);
+        replace_nondet_in_type(goto_trace_step.full_lhs, model);
       }
 
       if(SSA_step.ssa_full_lhs.is_not_nil())
       {
         goto_trace_step.full_lhs_value =
-          decision_procedure.get(SSA_step.ssa_full_lhs);
+          model.get_once(SSA_step.ssa_full_lhs);
         simplify(goto_trace_step.full_lhs_value, ns);
-        replace_nondet_in_type(
-          goto_trace_step.full_lhs_value, decision_procedure);
+        replace_nondet_in_type(goto_trace_step.full_lhs_value, model);
       }
 
       for(const auto &j : SSA_step.converted_io_args)
@@ -397,8 +433,7 @@ void build_goto_trace(
         }
         else
         {
-          exprt tmp = decision_procedure.get(j);
-          goto_trace_step.io_args.push_back(tmp);
+          goto_trace_step.io_args.push_back(model.get(j));
         }
       }
 
@@ -406,8 +441,7 @@ void build_goto_trace(
       {
         goto_trace_step.cond_expr = SSA_step.cond_expr;
 
-        goto_trace_step.cond_value =
-          decision_procedure.get(SSA_step.cond_handle).is_true();
+        goto_trace_step.cond_value = model.get(SSA_step.cond_handle).is_true();
       }
 
       if(ssa_step_it == last_step_to_keep)
@@ -25,6 +25,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/string_expr.h>
 #include <util/string_utils.h>
 
+#include <algorithm>
 #include <climits>
 
 unsigned goto_symext::dynamic_counter=0;
@@ -33,6 +34,21 @@ void goto_symext::do_simplify(exprt &expr)
 {
   if(symex_config.simplify_opt)
     simplify(expr, ns);
+
+  if(symex_config.hash_consing)
+    hash_cons(expr);
+}
+
+void goto_symext::hash_cons(exprt &expr)
+{
+  hash_consed_expressions(expr);
+
+  if(hash_consed_expressions.size() >= hash_consing_collection_threshold)
+  {
+    hash_consed_expressions.collect_garbage();
+    hash_consing_collection_threshold = std::max(
+      hash_consing_collection_threshold, 2 * hash_consed_expressions.size());
+  }
 }
 
 void goto_symext::symex_assign(statet &state, const code_assignt &code)
@@ -12,9 +12,14 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_SYMEX_GOTO_SYMEX_H
 #define CPROVER_GOTO_SYMEX_GOTO_SYMEX_H
 
+#include <util/merge_irep.h>
+#include <util/optional.h>
 #include <util/options.h>
 #include <util/message.h>
 
+#include <unordered_map>
+#include <vector>
+
 #include <goto-programs/abstract_goto_model.h>
 
 #include "complexity_limiter.h"
@@ -288,9 +293,36 @@ protected:
   /// \param write
   exprt clean_expr(exprt expr, statet &state, bool write);
 
+  /// The kinds of subexpressions that \ref clean_expr and \ref dereference
+  /// need to process in an expression. These only depend on the structure of
+  /// the expression, not on the renaming of its symbols.
+  struct clean_expr_shapet
+  {
+    bool has_nondet = false;
+    bool needs_dereferencing = false;
+    bool has_let = false;
+    bool has_byte_operator = false;
+  };
+
+  /// Get the \ref clean_expr_shapet of \p expr. The shapes of the
+  /// expressions of the goto program are memoized, such that re-executing an
+  /// instruction, for example when unwinding a loop, does not traverse its
+  /// expressions again only to find that there is nothing to clean up.
+  clean_expr_shapet get_clean_expr_shape(const exprt &expr);
+
+  /// Memo of \ref get_clean_expr_shape. Expressions that contain SSA or nondet
+  /// symbols are not stored, as they are specific to one execution.
+  std::unordered_map<exprt, clean_expr_shapet, irep_hash> clean_expr_shapes;
+
   void trigger_auto_object(const exprt &, statet &);
   void initialize_auto_object(const exprt &, statet &);
 
+  /// The auto objects materialised so far. When
+  /// \ref symex_configt::max_auto_objects is set, pointers that are lazily
+  /// initialised may also point to any of these of the right type, and no
+  /// more objects are created once the bound is reached.
+  std::vector<symbol_exprt> auto_objects;
+
   /// Given an expression, find the root object and the offset into it.
   ///
   /// The extra complication to be considered here is that the expression may
@@ -469,6 +501,9 @@ protected:
   ///    and proceed to executing the code of the function.
   ///   - otherwise assign a nondetministic value to the left-hand-side of the
   ///     call when there is one
+  /// When \ref symex_configt::function_summaries is set, calls to functions
+  /// that have a summary (see \ref get_function_summary) assign the summary
+  /// instantiated with the arguments to the return value instead.
   /// \param get_goto_function: The delegate to retrieve function bodies (see
   ///   \ref get_goto_functiont)
   /// \param state: Symbolic execution state for current instruction
@@ -483,6 +518,23 @@ protected:
     unsigned thread_nr,
     unsigned unwind);
 
+  /// Get the summary of a function whose body is a sequence of assignments to
+  /// its parameters, its local variables and its return value, from
+  /// expressions over these that have no side effects, and which neither read
+  /// nor write memory through pointers. The summary is the value the function
+  /// returns as an expression over its parameters, or nil if it does not
+  /// return a value. Summaries are computed once per function.
+  /// \param function_identifier: name of the function
+  /// \param goto_function: the function to summarise
+  /// \return the summary, or an empty optional if the function is not of the
+  ///   above shape
+  const optionalt<exprt> &get_function_summary(
+    const irep_idt &function_identifier,
+    const goto_functionst::goto_functiont &goto_function);
+
+  /// Memo of \ref get_function_summary
+  std::unordered_map<irep_idt, optionalt<exprt>> function_summaries;
+
   /// Iterates over \p arguments and assigns them to the parameters, which are
   /// symbols whose name and type are deduced from the type of \p goto_function.
   /// \param function_identifier: name of the function
@@ -503,8 +555,21 @@ protected:
   /// \param state: Symbolic execution state for current instruction
   void symex_catch(statet &state);
 
+  /// Simplify \p expr, if enabled, and intern it in
+  /// \ref hash_consed_expressions when hash consing is enabled.
   virtual void do_simplify(exprt &expr);
 
+  /// Replace \p expr by the structurally equal expression previously
+  /// interned, so that structurally equal expressions share their
+  /// representation and compare equal by pointer.
+  void hash_cons(exprt &expr);
+
+  /// Expressions interned by \ref hash_cons. Entries that are no longer
+  /// used outside the store are dropped whenever the store has doubled in
+  /// size since the last such collection.
+  merge_irept hash_consed_expressions;
+  std::size_t hash_consing_collection_threshold = 1 << 16;
+
   /// Symbolically execute an ASSIGN instruction or simulate such an execution
   /// for a synthetic assignment
   /// \param state: Symbolic execution state for current instruction
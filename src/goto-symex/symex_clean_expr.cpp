@@ -229,17 +229,64 @@ void goto_symext::lift_lets(statet &state, exprt &rhs)
   }
 }
 
+goto_symext::clean_expr_shapet
+goto_symext::get_clean_expr_shape(const exprt &expr)
+{
+  const auto entry = clean_expr_shapes.find(expr);
+  if(entry != clean_expr_shapes.end())
+    return entry->second;
+
+  clean_expr_shapet shape;
+  bool memoizable = true;
+
+  for(auto it = expr.depth_cbegin(); it != expr.depth_cend(); ++it)
+  {
+    const exprt &e = *it;
+    if(e.id() == ID_side_effect && e.get(ID_statement) == ID_nondet)
+      shape.has_nondet = true;
+    else if(
+      e.id() == ID_dereference || e.id() == ID_address_of ||
+      (e.id() == ID_index && to_index_expr(e).array().id() == ID_member))
+    {
+      shape.needs_dereferencing = true;
+    }
+    else if(e.id() == ID_let)
+      shape.has_let = true;
+    else if(
+      e.id() == ID_byte_extract_big_endian ||
+      e.id() == ID_byte_extract_little_endian ||
+      e.id() == ID_byte_update_big_endian ||
+      e.id() == ID_byte_update_little_endian)
+    {
+      shape.has_byte_operator = true;
+    }
+    else if(e.id() == ID_nondet_symbol || is_ssa_expr(e))
+      memoizable = false;
+  }
+
+  if(memoizable)
+    clean_expr_shapes.emplace(expr, shape);
+
+  return shape;
+}
+
 NODISCARD exprt
 goto_symext::clean_expr(exprt expr, statet &state, const bool write)
 {
-  replace_nondet(expr, path_storage.build_symex_nondet);
+  const clean_expr_shapet shape = get_clean_expr_shape(expr);
+
+  if(shape.has_nondet)
+    replace_nondet(expr, path_storage.build_symex_nondet);
   dereference(expr, state, write);
-  lift_lets(state, expr);
+
+  // dereferencing may introduce let expressions and byte operators
+  if(shape.has_let || shape.needs_dereferencing)
+    lift_lets(state, expr);
 
   // make sure all remaining byte extract operations use the root
   // object to avoid nesting of with/update and byte_update when on
   // lhs
-  if(write)
+  if(write && (shape.has_byte_operator || shape.needs_dereferencing))
     adjust_byte_extract_rec(expr, ns);
   return expr;
 }
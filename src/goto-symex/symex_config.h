@@ -30,12 +30,21 @@ struct symex_configt final
 
   bool simplify_opt;
 
+  /// \brief Whether to intern simplified expressions, such that structurally
+  /// equal expressions built during symex share their representation.
+  bool hash_consing;
+
   bool unwinding_assertions;
 
   bool partial_loops;
 
   bool havoc_undefined_functions;
 
+  /// \brief Whether to execute calls to functions that compute their return
+  /// value from their parameters in straight-line code by instantiating a
+  /// summary of the function, rather than by executing its body.
+  bool function_summaries;
+
   mp_integer debug_level;
 
   /// \brief Should the additional validation checks be run?
@@ -51,6 +60,12 @@ struct symex_configt final
   /// Maximum sizes for which field sensitivity will be applied to array cells
   std::size_t max_field_sensitivity_array_size;
 
+  /// \brief Maximum number of auto objects to materialise when lazily
+  /// initialising pointers, see \ref auto_objects.cpp. Once the bound is
+  /// reached, pointers may only be null or point to objects that exist
+  /// already. Zero means no bound and no aliasing between auto objects.
+  std::size_t max_auto_objects;
+
   /// \brief Whether this run of symex is under complexity limits. This
   /// enables certain analyses that otherwise aren't run.
   bool complexity_limits_active;
@@ -400,16 +400,19 @@ void goto_symext::dereference(exprt &expr, statet &state, bool write)
 {
   PRECONDITION(!state.call_stack().empty());
 
-  // Symbols whose address is taken need to be renamed to level 1
-  // in order to distinguish addresses of local variables
-  // from different frames.
-  expr = apply_to_objects_in_dereference(std::move(expr), [&](exprt e) {
-    return state.field_sensitivity.apply(
-      ns, state, state.rename<L1>(std::move(e), ns).get(), false);
-  });
-
-  // start the recursion!
-  dereference_rec(expr, state, write);
+  if(get_clean_expr_shape(expr).needs_dereferencing)
+  {
+    // Symbols whose address is taken need to be renamed to level 1
+    // in order to distinguish addresses of local variables
+    // from different frames.
+    expr = apply_to_objects_in_dereference(std::move(expr), [&](exprt e) {
+      return state.field_sensitivity.apply(
+        ns, state, state.rename<L1>(std::move(e), ns).get(), false);
+    });
+
+    // start the recursion!
+    dereference_rec(expr, state, write);
+  }
   // dereferencing may introduce new symbol_exprt
   // (like __CPROVER_memory)
   expr = state.rename<L1>(std::move(expr), ns).get();
@@ -16,11 +16,16 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/byte_operators.h>
 #include <util/c_types.h>
 #include <util/exception_utils.h>
+#include <util/expr_util.h>
 #include <util/fresh_symbol.h>
 #include <util/invariant.h>
 #include <util/prefix.h>
 #include <util/range.h>
 
+#include <goto-programs/remove_returns.h>
+
+#include <unordered_set>
+
 #include "expr_skeleton.h"
 #include "symex_assign.h"
 
@@ -218,6 +223,148 @@ void goto_symext::symex_function_call_symbol(
     symex_function_call_code(get_goto_function, state, code);
 }
 
+/// Replace the symbols in \p expr that \p values has a value for
+/// \return false if a symbol is replaced by a value of a different type
+static bool substitute(
+  exprt &expr,
+  const std::unordered_map<irep_idt, exprt> &values)
+{
+  if(expr.id() == ID_symbol)
+  {
+    const auto value_it = values.find(to_symbol_expr(expr).get_identifier());
+    if(value_it == values.end())
+      return true;
+    if(value_it->second.type() != expr.type())
+      return false;
+    expr = value_it->second;
+    return true;
+  }
+
+  for(auto &op : expr.operands())
+  {
+    if(!substitute(op, values))
+      return false;
+  }
+
+  return true;
+}
+
+/// \return true if \p expr has more than \p max_size nodes, counting shared
+///   subexpressions once per occurrence, as symex does when it traverses it
+static bool exceeds_size(const exprt &expr, std::size_t &max_size)
+{
+  if(max_size == 0)
+    return true;
+  --max_size;
+
+  for(const auto &op : expr.operands())
+  {
+    if(exceeds_size(op, max_size))
+      return true;
+  }
+
+  return false;
+}
+
+const optionalt<exprt> &goto_symext::get_function_summary(
+  const irep_idt &function_identifier,
+  const goto_functionst::goto_functiont &goto_function)
+{
+  const auto emplace_result =
+    function_summaries.emplace(function_identifier, optionalt<exprt>{});
+  optionalt<exprt> &summary = emplace_result.first->second;
+  if(!emplace_result.second || !goto_function.body_available())
+    return summary;
+
+  // larger summaries would be more expensive to instantiate than the body
+  const std::size_t max_summary_size = 1000;
+
+  const irep_idt return_value = return_value_identifier(function_identifier);
+  std::unordered_set<irep_idt> locals(
+    goto_function.parameter_identifiers.begin(),
+    goto_function.parameter_identifiers.end());
+
+  // the value of each local assigned so far, and of the return value, in
+  // terms of the values of the parameters on entry
+  std::unordered_map<irep_idt, exprt> values;
+
+  for(const auto &instruction : goto_function.body.instructions)
+  {
+    if(instruction.is_decl())
+    {
+      const irep_idt &identifier = instruction.get_decl().get_identifier();
+      locals.insert(identifier);
+      values.erase(identifier);
+    }
+    else if(instruction.is_assign())
+    {
+      const code_assignt &assign = instruction.get_assign();
+      if(assign.lhs().id() != ID_symbol)
+        return summary;
+
+      const irep_idt &lhs_identifier =
+        to_symbol_expr(assign.lhs()).get_identifier();
+      if(locals.count(lhs_identifier) == 0 && lhs_identifier != return_value)
+        return summary;
+
+      const bool has_effects = has_subexpr(assign.rhs(), [&](const exprt &e) {
+        return e.id() == ID_side_effect || e.id() == ID_dereference ||
+               e.id() == ID_address_of || e.id() == ID_function_application ||
+               (e.id() == ID_symbol &&
+                locals.count(to_symbol_expr(e).get_identifier()) == 0);
+      });
+      if(has_effects)
+        return summary;
+
+      exprt value = assign.rhs();
+      std::size_t max_size = max_summary_size;
+      if(
+        value.type() != assign.lhs().type() || !substitute(value, values) ||
+        exceeds_size(value, max_size))
+      {
+        return summary;
+      }
+
+      values[lhs_identifier] = std::move(value);
+    }
+    else if(
+      instruction.is_goto() && instruction.get_condition().is_true() &&
+      instruction.get_target()->is_end_function())
+    {
+      // a return statement, the remaining instructions are unreachable
+      break;
+    }
+    else if(
+      !instruction.is_dead() && !instruction.is_skip() &&
+      !instruction.is_location() && !instruction.is_end_function())
+    {
+      return summary;
+    }
+  }
+
+  const auto return_value_it = values.find(return_value);
+  if(return_value_it == values.end())
+  {
+    summary = nil_exprt();
+    return summary;
+  }
+
+  // locals that are read before they are assigned have a nondeterministic
+  // value, which differs between calls
+  const std::unordered_set<irep_idt> parameters(
+    goto_function.parameter_identifiers.begin(),
+    goto_function.parameter_identifiers.end());
+  const bool reads_uninitialized_local =
+    has_subexpr(return_value_it->second, [&parameters](const exprt &e) {
+      return e.id() == ID_symbol &&
+             parameters.count(to_symbol_expr(e).get_identifier()) == 0;
+    });
+  if(!reads_uninitialized_local)
+    summary = return_value_it->second;
+
+  return summary;
+}
+
 void goto_symext::symex_function_call_code(
   const get_goto_functiont &get_goto_function,
   statet &state,
@@ -314,6 +461,47 @@ void goto_symext::symex_function_call_code(
     return;
   }
 
+  if(symex_config.function_summaries && call.lhs().is_nil())
+  {
+    const optionalt<exprt> &summary =
+      get_function_summary(identifier, goto_function);
+
+    // the summary is in terms of the parameters, which we replace by the
+    // arguments as long as they match
+    std::unordered_map<irep_idt, exprt> parameter_values;
+    if(
+      summary.has_value() &&
+      arguments.size() == goto_function.parameter_identifiers.size())
+    {
+      for(std::size_t i = 0; i < arguments.size(); ++i)
+      {
+        const irep_idt &parameter = goto_function.parameter_identifiers[i];
+        if(ns.lookup(parameter).type == arguments[i].type())
+          parameter_values.emplace(parameter, arguments[i]);
+      }
+    }
+
+    if(
+      summary.has_value() &&
+      parameter_values.size() == goto_function.parameter_identifiers.size())
+    {
+      if(summary->is_not_nil())
+      {
+        exprt rhs = *summary;
+        const bool substituted = substitute(rhs, parameter_values);
+        CHECK_RETURN(substituted);
+        symex_assign(
+          state, code_assignt(return_value_symbol(identifier, ns), rhs));
+      }
+
+      target.function_return(
+        state.guard.as_expr(), identifier, state.source, hidden);
+
+      symex_transition(state);
+      return;
+    }
+  }
+
   // produce a new frame
   PRECONDITION(!state.call_stack().empty());
   framet &frame = state.call_stack().new_frame(state.source, state.guard);
@@ -40,10 +40,12 @@ symex_configt::symex_configt(const optionst &options)
     self_loops_to_assumptions(
       options.get_bool_option("self-loops-to-assumptions")),
     simplify_opt(options.get_bool_option("simplify")),
+    hash_consing(options.get_bool_option("hash-consing")),
     unwinding_assertions(options.get_bool_option("unwinding-assertions")),
     partial_loops(options.get_bool_option("partial-loops")),
     havoc_undefined_functions(
       options.get_bool_option("havoc-undefined-functions")),
+    function_summaries(options.get_bool_option("function-summaries")),
     debug_level(unsafe_string2int(options.get_option("debug-level"))),
     run_validation_checks(options.get_bool_option("validate-ssa-equation")),
     show_symex_steps(options.get_bool_option("show-goto-symex-steps")),
@@ -55,6 +57,7 @@ symex_configt::symex_configt(const optionst &options)
             ? options.get_unsigned_int_option(
                 "max-field-sensitivity-array-size")
             : DEFAULT_MAX_FIELD_SENSITIVITY_ARRAY_SIZE),
+    max_auto_objects(options.get_unsigned_int_option("max-auto-objects")),
     complexity_limits_active(
       options.get_signed_int_option("symex-complexity-limit") > 0)
 {
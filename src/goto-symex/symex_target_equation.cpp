@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "symex_target_equation.h"
 
 #include <chrono>
+#include <iterator>
 
 #include <util/format_expr.h>
 #include <util/std_expr.h>
@@ -621,37 +622,43 @@ void symex_target_equationt::convert_function_calls(
   for(auto &step : SSA_steps)
   {
     if(!step.ignore)
+      convert_function_call_arguments(step, step_index, decision_procedure);
+    ++step_index;
+  }
+}
+
+void symex_target_equationt::convert_function_call_arguments(
+  SSA_stept &step,
+  std::size_t step_index,
+  decision_proceduret &decision_procedure)
+{
+  and_exprt::operandst conjuncts;
+  step.converted_function_arguments.reserve(step.ssa_function_arguments.size());
+
+  for(const auto &arg : step.ssa_function_arguments)
+  {
+    if(arg.is_constant() ||
+       arg.id()==ID_string_constant)
+      step.converted_function_arguments.push_back(arg);
+    else
     {
-      and_exprt::operandst conjuncts;
-      step.converted_function_arguments.reserve(step.ssa_function_arguments.size());
+      const irep_idt identifier="symex::args::"+std::to_string(argument_count++);
+      symbol_exprt symbol(identifier, arg.type());
 
-      for(const auto &arg : step.ssa_function_arguments)
-      {
-        if(arg.is_constant() ||
-           arg.id()==ID_string_constant)
-          step.converted_function_arguments.push_back(arg);
-        else
-        {
-          const irep_idt identifier="symex::args::"+std::to_string(argument_count++);
-          symbol_exprt symbol(identifier, arg.type());
-
-          equal_exprt eq(arg, symbol);
-          merge_irep(eq);
-
-          decision_procedure.set_to(eq, true);
-          conjuncts.push_back(eq);
-          step.converted_function_arguments.push_back(symbol);
-        }
-      }
-      with_solver_hardness(
-        decision_procedure,
-        [step_index, &conjuncts, &step](solver_hardnesst &hardness) {
-          hardness.register_ssa(
-            step_index, conjunction(conjuncts), step.source.pc);
-        });
+      equal_exprt eq(arg, symbol);
+      merge_irep(eq);
+
+      decision_procedure.set_to(eq, true);
+      conjuncts.push_back(eq);
+      step.converted_function_arguments.push_back(symbol);
     }
-    ++step_index;
   }
+  with_solver_hardness(
+    decision_procedure,
+    [step_index, &conjuncts, &step](solver_hardnesst &hardness) {
+      hardness.register_ssa(
+        step_index, conjunction(conjuncts), step.source.pc);
+    });
 }
 
 void symex_target_equationt::convert_io(decision_proceduret &decision_procedure)
@@ -660,35 +667,96 @@ void symex_target_equationt::convert_io(decision_proceduret &decision_procedure)
   for(auto &step : SSA_steps)
   {
     if(!step.ignore)
+      convert_io_arguments(step, step_index, decision_procedure);
+    ++step_index;
+  }
+}
+
+void symex_target_equationt::convert_io_arguments(
+  SSA_stept &step,
+  std::size_t step_index,
+  decision_proceduret &decision_procedure)
+{
+  and_exprt::operandst conjuncts;
+  for(const auto &arg : step.io_args)
+  {
+    if(arg.is_constant() ||
+       arg.id()==ID_string_constant)
+      step.converted_io_args.push_back(arg);
+    else
     {
-      and_exprt::operandst conjuncts;
-      for(const auto &arg : step.io_args)
-      {
-        if(arg.is_constant() ||
-           arg.id()==ID_string_constant)
-          step.converted_io_args.push_back(arg);
-        else
-        {
-          const irep_idt identifier =
-            "symex::io::" + std::to_string(io_count++);
-          symbol_exprt symbol(identifier, arg.type());
-
-          equal_exprt eq(arg, symbol);
-          merge_irep(eq);
-
-          decision_procedure.set_to(eq, true);
-          conjuncts.push_back(eq);
-          step.converted_io_args.push_back(symbol);
-        }
-      }
-      with_solver_hardness(
-        decision_procedure,
-        [step_index, &conjuncts, &step](solver_hardnesst &hardness) {
-          hardness.register_ssa(
-            step_index, conjunction(conjuncts), step.source.pc);
-        });
+      const irep_idt identifier =
+        "symex::io::" + std::to_string(io_count++);
+      symbol_exprt symbol(identifier, arg.type());
+
+      equal_exprt eq(arg, symbol);
+      merge_irep(eq);
+
+      decision_procedure.set_to(eq, true);
+      conjuncts.push_back(eq);
+      step.converted_io_args.push_back(symbol);
     }
-    ++step_index;
+  }
+  with_solver_hardness(
+    decision_procedure,
+    [step_index, &conjuncts, &step](solver_hardnesst &hardness) {
+      hardness.register_ssa(
+        step_index, conjunction(conjuncts), step.source.pc);
+    });
+}
+
+void symex_target_equationt::convert_new_steps(
+  decision_proceduret &decision_procedure)
+{
+  // Walk backwards from the end, as typically only few steps have been added
+  // since the previous call.
+  auto step_it =
+    std::prev(SSA_steps.end(), SSA_steps.size() - converted_step_count);
+
+  for(; step_it != SSA_steps.end(); ++step_it, ++converted_step_count)
+  {
+    SSA_stept &step = *step_it;
+    const std::size_t step_index = converted_step_count;
+
+    if(step.ignore)
+    {
+      step.guard_handle = false_exprt();
+      if(step.is_assume() || step.is_goto())
+        step.cond_handle = true_exprt();
+      continue;
+    }
+
+    log.conditional_output(log.debug(), [&step](messaget::mstreamt &mstream) {
+      step.output(mstream);
+      mstream << messaget::eom;
+    });
+
+    step.guard_handle = decision_procedure.handle(step.guard);
+
+    if(step.is_assignment() || step.is_constraint())
+    {
+      decision_procedure.set_to_true(step.cond_expr);
+      step.converted = true;
+    }
+    else if(step.is_decl())
+    {
+      decision_procedure.handle(step.cond_expr);
+      step.converted = true;
+    }
+    else if(step.is_assume() || step.is_goto())
+      step.cond_handle = decision_procedure.handle(step.cond_expr);
+
+    with_solver_hardness(
+      decision_procedure, hardness_register_ssa(step_index, step));
+
+    convert_function_call_arguments(step, step_index, decision_procedure);
+    convert_io_arguments(step, step_index, decision_procedure);
+
+    // Only the converted forms are needed from here on. The guard is kept as
+    // its handle, which the memory model may still refer to.
+    step.guard = step.guard_handle;
+    step.ssa_function_arguments.clear();
+    step.io_args.clear();
   }
 }
 
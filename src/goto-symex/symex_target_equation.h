@@ -235,6 +235,17 @@ public:
   /// \param decision_procedure: A handle to a decision procedure interface
   void convert_io(decision_proceduret &decision_procedure);
 
+  /// Converts all steps added since the previous call, one step at a time,
+  /// except for assertions. This permits converting the equation while symex
+  /// is still extending it, rather than holding all of it until symex is
+  /// complete. Once a step has been converted its guard is replaced by its
+  /// handle and the unconverted arguments of function calls and I/O are
+  /// released. When symex is done, call this once more and then use
+  /// \ref convert_assertions. Do not mix with the other conversion methods,
+  /// which would convert the steps again.
+  /// \param decision_procedure: A handle to a decision procedure interface
+  void convert_new_steps(decision_proceduret &decision_procedure);
+
   exprt make_expression() const;
 
   std::size_t count_assertions() const
@@ -300,6 +311,18 @@ protected:
 
   // for unique function call argument identifiers
   std::size_t argument_count = 0;
+
+  /// Number of leading steps converted by \ref convert_new_steps
+  std::size_t converted_step_count = 0;
+
+  void convert_function_call_arguments(
+    SSA_stept &step,
+    std::size_t step_index,
+    decision_proceduret &decision_procedure);
+  void convert_io_arguments(
+    SSA_stept &step,
+    std::size_t step_index,
+    decision_proceduret &decision_procedure);
 };
 
 inline bool operator<(
@@ -389,14 +389,23 @@ exprt gdb_value_extractort::get_non_char_pointer_value(
     if(allocated_size != 1 && number_of_elements > 1)
     {
       array_exprt::operandst elements;
-      // build the operands by querying for an index expression
-      for(size_t i = 0; i < number_of_elements; i++)
+      if(
+        auto values = get_integral_values(
+          expr, numeric_cast_v<std::size_t>(number_of_elements)))
       {
-        const auto sub_expr_value = get_expr_value(
-          index_exprt{expr, from_integer(i, index_type())},
-          *zero_expr,
-          location);
-        elements.push_back(sub_expr_value);
+        elements = std::move(*values);
+      }
+      else
+      {
+        // build the operands by querying for an index expression
+        for(size_t i = 0; i < number_of_elements; i++)
+        {
+          const auto sub_expr_value = get_expr_value(
+            index_exprt{expr, from_integer(i, index_type())},
+            *zero_expr,
+            location);
+          elements.push_back(sub_expr_value);
+        }
       }
       CHECK_RETURN(elements.size() == number_of_elements);
 
@@ -564,6 +573,27 @@ exprt gdb_value_extractort::get_pointer_value(
   return zero_expr;
 }
 
+optionalt<exprt::operandst>
+gdb_value_extractort::get_integral_values(const exprt &expr, std::size_t count)
+{
+  const typet &element_type = expr.type().subtype();
+  if(!is_c_integral_type(element_type) || count < 2)
+    return {};
+
+  const index_exprt first_element{expr, from_integer(0, index_type())};
+  const auto maybe_values =
+    gdb_api.get_values(c_converter.convert(first_element), count);
+  if(!maybe_values.has_value())
+    return {};
+
+  exprt::operandst elements;
+  elements.reserve(count);
+  for(const auto &value : *maybe_values)
+    elements.push_back(from_integer(string2integer(value), element_type));
+
+  return std::move(elements);
+}
+
 exprt gdb_value_extractort::get_array_value(
   const exprt &expr,
   const exprt &array,
@@ -576,6 +606,12 @@ exprt gdb_value_extractort::get_array_value(
 
   exprt new_array(array);
 
+  if(auto values = get_integral_values(expr, new_array.operands().size()))
+  {
+    new_array.operands() = std::move(*values);
+    return new_array;
+  }
+
   for(size_t i = 0; i < new_array.operands().size(); ++i)
   {
     const index_exprt index_expr(expr, from_integer(i, index_type()));
@@ -207,6 +207,15 @@ private:
   /// \param value: the value to be assigned; the result of \ref get_expr_value
   void add_assignment(const exprt &lhs, const exprt &value);
 
+  /// Get the values of the first \p count elements of \p expr with a single
+  ///   query to \ref gdb_apit::get_values rather than one per element.
+  /// \param expr: an array, or a pointer to the first element
+  /// \param count: the number of elements
+  /// \return the elements, or an empty optionalt if the elements are not of
+  ///   integral type or gdb could not read them all at once
+  optionalt<exprt::operandst>
+  get_integral_values(const exprt &expr, std::size_t count);
+
   /// Iterate over \p array and fill its operands with the results of calling
   ///   \ref get_expr_value on index expressions into \p expr.
   /// \param expr: the expression to be analysed
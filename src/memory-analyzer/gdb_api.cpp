@@ -163,6 +163,13 @@ void gdb_apit::create_gdb_process()
 
     write_to_gdb("-gdb-set max-value-size unlimited");
     check_command_accepted();
+
+    // print all elements of the arrays read by get_values, without
+    // compressing repeated elements
+    write_to_gdb("-gdb-set print elements unlimited");
+    check_command_accepted();
+    write_to_gdb("-gdb-set print repeats unlimited");
+    check_command_accepted();
   }
 }
 
@@ -514,6 +521,45 @@ optionalt<std::string> gdb_apit::get_value(const std::string &expr)
   return value;
 }
 
+optionalt<std::vector<std::string>>
+gdb_apit::get_values(const std::string &expr, std::size_t count)
+{
+  PRECONDITION(gdb_state == gdb_statet::STOPPED);
+  PRECONDITION(count > 0);
+
+  // the @ operator makes gdb treat the objects as an artificial array
+  write_to_gdb(
+    "-data-evaluate-expression \"(" + expr + ")@" + std::to_string(count) +
+    "\"");
+
+  gdb_output_recordt record;
+  try
+  {
+    record = get_most_recent_record("^done");
+  }
+  catch(gdb_interaction_exceptiont &e)
+  {
+    return {};
+  }
+
+  const auto it = record.find("value");
+  CHECK_RETURN(it != record.end());
+  const std::string &value = it->second;
+
+  // the value has the form {v1, v2, ...}
+  if(value.size() < 2 || value.front() != '{' || value.back() != '}')
+    return {};
+
+  std::vector<std::string> values =
+    split_string(value.substr(1, value.size() - 2), ',', true);
+
+  // the printing of the array may have been truncated or compressed
+  if(values.size() != count)
+    return {};
+
+  return std::move(values);
+}
+
 gdb_apit::gdb_output_recordt
 gdb_apit::parse_gdb_output_record(const std::string &s)
 {
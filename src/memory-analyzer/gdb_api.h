@@ -130,6 +130,16 @@ public:
   /// \return memory address in hex format
   optionalt<std::string> get_value(const std::string &expr);
 
+  /// Get the values of \p count consecutive objects in memory, the first of
+  /// which is \p expr, with a single query rather than one per object
+  /// \param expr: an lvalue expression of integral type (e.g., `a[0]` or
+  ///   `*p`)
+  /// \param count: number of objects to read
+  /// \return the values, or an empty optionalt if gdb could not evaluate the
+  ///   objects
+  optionalt<std::vector<std::string>>
+  get_values(const std::string &expr, std::size_t count);
+
   /// Get the value of a pointer associated with \p expr
   /// \param expr: the expression to be analyzed
   /// \return the \p pointer_valuet filled with data gdb produced for \p expr
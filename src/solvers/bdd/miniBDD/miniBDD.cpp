@@ -186,22 +186,42 @@ void mini_bdd_mgrt::DumpTikZ(
 class mini_bdd_applyt
 {
 public:
-  inline explicit mini_bdd_applyt(bool (*_fkt)(bool, bool)) : fkt(_fkt)
+  inline explicit mini_bdd_applyt(bool (*_fkt)(bool, bool))
+    : fkt(_fkt),
+      operation(
+        fkt(false, false) | fkt(false, true) << 1 | fkt(true, false) << 2 |
+        fkt(true, true) << 3)
   {
   }
 
   mini_bddt operator()(const mini_bddt &x, const mini_bddt &y)
   {
+    PRECONDITION_WITH_DIAGNOSTICS(
+      x.is_initialized() && y.is_initialized(),
+      "apply can only be called on initialized BDDs");
+
+    // only ever cleared between operations, as the entries made by an
+    // operation are used while it is in progress
+    mini_bdd_mgrt::computed_tablet &computed_table =
+      x.node->mgr->computed_table;
+    if(computed_table.size() > mini_bdd_mgrt::max_computed_table_size)
+      computed_table.clear();
+
     return APP_non_rec(x, y);
   }
 
 protected:
   bool (*fkt)(bool, bool);
+  // the truth table of fkt
+  const unsigned operation;
+
   mini_bddt APP_rec(const mini_bddt &x, const mini_bddt &y);
   mini_bddt APP_non_rec(const mini_bddt &x, const mini_bddt &y);
 
-  typedef std::map<std::pair<unsigned, unsigned>, mini_bddt> Gt;
-  Gt G;
+  mini_bdd_mgrt::computed_keyt key(const mini_bddt &x, const mini_bddt &y) const
+  {
+    return {operation, x.node_number(), y.node_number()};
+  }
 };
 
 mini_bddt mini_bdd_applyt::APP_rec(const mini_bddt &x, const mini_bddt &y)
@@ -213,14 +233,13 @@ mini_bddt mini_bdd_applyt::APP_rec(const mini_bddt &x, const mini_bddt &y)
     x.node->mgr == y.node->mgr,
     "apply can only be called on BDDs with the same manager");
 
-  // dynamic programming
-  std::pair<unsigned, unsigned> key(x.node_number(), y.node_number());
-  Gt::const_iterator G_it = G.find(key);
-  if(G_it != G.end())
-    return G_it->second;
-
   mini_bdd_mgrt *mgr = x.node->mgr;
 
+  // dynamic programming
+  const auto computed_it = mgr->computed_table.find(key(x, y));
+  if(computed_it != mgr->computed_table.end())
+    return computed_it->second.result;
+
   mini_bddt u;
 
   if(x.is_constant() && y.is_constant())
@@ -233,7 +252,8 @@ mini_bddt mini_bdd_applyt::APP_rec(const mini_bddt &x, const mini_bddt &y)
   else /* x.var() > y.var() */
     u = mgr->mk(y.var(), APP_rec(x, y.low()), APP_rec(x, y.high()));
 
-  G[key] = u;
+  mgr->computed_table.emplace(
+    key(x, y), mini_bdd_mgrt::computed_entryt{x, y, u});
 
   return u;
 }
@@ -243,16 +263,10 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
   struct stack_elementt
   {
     stack_elementt(mini_bddt &_result, const mini_bddt &_x, const mini_bddt &_y)
-      : result(_result),
-        x(_x),
-        y(_y),
-        key(x.node_number(), y.node_number()),
-        var(0),
-        phase(phaset::INIT)
+      : result(_result), x(_x), y(_y), var(0), phase(phaset::INIT)
     {
     }
     mini_bddt &result, x, y, lr, hr;
-    std::pair<unsigned, unsigned> key;
     unsigned var;
     enum class phaset
     {
@@ -284,10 +298,12 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
     case stack_elementt::phaset::INIT:
     {
       // dynamic programming
-      Gt::const_iterator G_it = G.find(t.key);
-      if(G_it != G.end())
+      const mini_bdd_mgrt::computed_tablet &computed_table =
+        x.node->mgr->computed_table;
+      const auto computed_it = computed_table.find(key(x, y));
+      if(computed_it != computed_table.end())
       {
-        t.result = G_it->second;
+        t.result = computed_it->second.result;
         stack.pop();
       }
       else
@@ -350,7 +366,8 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
     {
       mini_bdd_mgrt *mgr = x.node->mgr;
       t.result = mgr->mk(t.var, t.lr, t.hr);
-      G[t.key] = t.result;
+      mgr->computed_table.emplace(
+        key(x, y), mini_bdd_mgrt::computed_entryt{x, y, t.result});
       stack.pop();
     }
     break;
@@ -421,6 +438,8 @@ mini_bdd_mgrt::mini_bdd_mgrt()
 
 mini_bdd_mgrt::~mini_bdd_mgrt()
 {
+  // release the references to the nodes while the tables still exist
+  computed_table.clear();
 }
 
 mini_bddt
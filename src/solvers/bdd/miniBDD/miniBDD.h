@@ -25,6 +25,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <map>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class mini_bddt
@@ -101,6 +102,7 @@ public:
   const mini_bddt &False() const;
 
   friend class mini_bdd_nodet;
+  friend class mini_bdd_applyt;
 
   // create a node (consulting the reverse-map)
   mini_bddt mk(unsigned var, const mini_bddt &low, const mini_bddt &high);
@@ -128,13 +130,50 @@ protected:
     reverse_keyt(unsigned _var, const mini_bddt &_low, const mini_bddt &_high);
 
     bool operator<(const reverse_keyt &) const;
+    bool operator==(const reverse_keyt &) const;
   };
 
-  typedef std::map<reverse_keyt, mini_bdd_nodet *> reverse_mapt;
+  struct reverse_key_hasht
+  {
+    std::size_t operator()(const reverse_keyt &) const;
+  };
+
+  typedef std::unordered_map<reverse_keyt, mini_bdd_nodet *, reverse_key_hasht>
+    reverse_mapt;
   reverse_mapt reverse_map;
 
   typedef std::stack<mini_bdd_nodet *> freet;
   freet free;
+
+  // The computed table, which caches the results of the Boolean operations
+  // across calls. The operation is identified by its truth table.
+  struct computed_keyt
+  {
+    unsigned operation, x, y;
+
+    bool operator==(const computed_keyt &) const;
+  };
+
+  struct computed_key_hasht
+  {
+    std::size_t operator()(const computed_keyt &) const;
+  };
+
+  struct computed_entryt
+  {
+    // The operands are referenced, such that their node numbers are not
+    // reused for other nodes while the entry exists.
+    mini_bddt x, y, result;
+  };
+
+  typedef std::unordered_map<computed_keyt, computed_entryt, computed_key_hasht>
+    computed_tablet;
+  // declared last, as its entries reference nodes
+  computed_tablet computed_table;
+
+  // The computed table is cleared once it exceeds this size, which releases
+  // the nodes that are only referenced by the table.
+  static const std::size_t max_computed_table_size = 1 << 18;
 };
 
 mini_bddt restrict(const mini_bddt &u, unsigned var, const bool value);
@@ -59,7 +59,7 @@ bool boolbvt::literal(
 
       INVARIANT(
         bit < map_entry.literal_map.size(), "bit index shall be within bounds");
-      if(!map_entry.literal_map[bit].is_set)
+      if(!map_entry.literal_map[bit].is_set())
         return true;
 
       dest=map_entry.literal_map[bit].l;
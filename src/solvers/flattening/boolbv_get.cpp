@@ -47,7 +47,7 @@ exprt boolbvt::get(const exprt &expr) const
       {
         assert(bit_nr<map_entry.literal_map.size());
 
-        if(map_entry.literal_map[bit_nr].is_set)
+        if(map_entry.literal_map[bit_nr].is_set())
         {
           unknown[bit_nr]=false;
           bv[bit_nr]=map_entry.literal_map[bit_nr].l;
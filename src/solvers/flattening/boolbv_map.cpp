@@ -28,7 +28,7 @@ std::string boolbv_mapt::map_entryt::get_value(const propt &prop) const
   {
     char ch='*';
 
-    if(literal_map[i].is_set)
+    if(literal_map[i].is_set())
     {
       tvt value=prop.l_get(literal_map[i].l);
 
@@ -102,7 +102,7 @@ void boolbv_mapt::get_literals(
       bit < map_entry.literal_map.size(), "bit index shall be within bounds");
     map_bitt &mb=map_entry.literal_map[bit];
 
-    if(mb.is_set)
+    if(mb.is_set())
     {
       l=mb.l;
       continue;
@@ -110,7 +110,6 @@ void boolbv_mapt::get_literals(
 
     l=prop.new_variable();
 
-    mb.is_set=true;
     mb.l=l;
 
     #ifdef DEBUG
@@ -141,13 +140,12 @@ void boolbv_mapt::set_literals(
       bit < map_entry.literal_map.size(), "bit index shall be within bounds");
     map_bitt &mb=map_entry.literal_map[bit];
 
-    if(mb.is_set)
+    if(mb.is_set())
     {
       prop.set_equal(mb.l, literal);
       continue;
     }
 
-    mb.is_set=true;
     mb.l=literal;
   }
 }
@@ -28,11 +28,17 @@ public:
   {
   }
 
+  /// A bit of a mapped bit-vector: bits that have not been assigned a literal
+  /// yet hold a literal with the unused variable number, which avoids storing
+  /// a separate flag next to every literal.
   struct map_bitt
   {
-    map_bitt():is_set(false) { }
-    bool is_set;
     literalt l;
+
+    bool is_set() const
+    {
+      return l.var_no() != literalt::unused_var_no();
+    }
   };
 
   typedef std::vector<map_bitt> literal_mapt;
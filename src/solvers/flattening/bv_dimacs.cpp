@@ -57,7 +57,7 @@ bool bv_dimacst::write_dimacs(std::ostream &out)
     out << "c " << m.first;
 
     for(const auto &lit : literal_map)
-      if(!lit.is_set)
+      if(!lit.is_set())
         out << " "
             << "?";
       else if(lit.l.is_constant())
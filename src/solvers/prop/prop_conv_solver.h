@@ -9,7 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_SOLVERS_PROP_PROP_CONV_SOLVER_H
 #define CPROVER_SOLVERS_PROP_PROP_CONV_SOLVER_H
 
-#include <map>
+#include <unordered_map>
 #include <string>
 
 #include <util/expr.h>
@@ -81,7 +81,7 @@ public:
     cache.clear();
   }
 
-  typedef std::map<irep_idt, literalt> symbolst;
+  typedef std::unordered_map<irep_idt, literalt> symbolst;
   typedef std::unordered_map<exprt, literalt, irep_hash> cachet;
 
   const cachet &get_cache() const
@@ -373,11 +373,41 @@ irep_idt bvrep_bitwise_op(
   });
 }
 
+/// Bit-vector representation of the \p width least significant bits of
+/// \p value, for widths that fit into a machine word.
+static irep_idt word2bvrep(unsigned long long value, std::size_t width)
+{
+  PRECONDITION(width <= 64);
+
+  if(width < 64)
+    value &= (1ull << width) - 1;
+
+  if(value == 0)
+    return ID_0;
+
+  char buffer[16];
+  char *begin = buffer + sizeof(buffer);
+  for(; value != 0; value >>= 4)
+    *--begin = nibble2hex(static_cast<unsigned char>(value & 0xf));
+
+  return std::string(begin, buffer + sizeof(buffer));
+}
+
 /// convert an integer to bit-vector representation with given width
 /// This uses two's complement for negative numbers.
 /// If the value is out of range, it is 'wrapped around'.
 irep_idt integer2bvrep(const mp_integer &src, std::size_t width)
 {
+  // Avoid big-integer arithmetic for the common case of values and
+  // widths that fit into a machine word.
+  if(width <= 64)
+  {
+    if(src.is_negative() && src.is_long())
+      return word2bvrep(static_cast<unsigned long long>(src.to_long()), width);
+    else if(!src.is_negative() && src.is_ulong())
+      return word2bvrep(src.to_ulong(), width);
+  }
+
   const mp_integer p = power(2, width);
 
   if(src.is_negative())
@@ -397,9 +427,49 @@ irep_idt integer2bvrep(const mp_integer &src, std::size_t width)
   }
 }
 
+/// Parse the bit-vector representation \p src into a machine word.
+/// \return false if \p src is not a valid representation of at most 64
+///   bits, in which case \p value is unspecified
+static bool bvrep2word(const irep_idt &src, unsigned long long &value)
+{
+  const std::string &digits = id2string(src);
+  if(digits.empty() || digits.size() > 16)
+    return false;
+
+  value = 0;
+  for(const char nibble : digits)
+  {
+    value <<= 4;
+    if(nibble >= '0' && nibble <= '9')
+      value |= static_cast<unsigned long long>(nibble - '0');
+    else if(nibble >= 'A' && nibble <= 'F')
+      value |= static_cast<unsigned long long>(nibble - 'A' + 10);
+    else
+      return false;
+  }
+
+  return true;
+}
+
 /// convert a bit-vector representation (possibly signed) to integer
 mp_integer bvrep2integer(const irep_idt &src, std::size_t width, bool is_signed)
 {
+  // Avoid parsing into a big integer for the common case of widths that
+  // fit into a machine word.
+  unsigned long long word;
+  if(width >= 1 && width <= 64 && bvrep2word(src, word))
+  {
+    PRECONDITION(width == 64 || word < (1ull << width));
+
+    if(!is_signed || (word >> (width - 1)) == 0)
+      return word;
+
+    // sign-extend to 64 bits, then negate without overflowing
+    if(width < 64)
+      word |= ~((1ull << width) - 1);
+    return -mp_integer(~word) - 1;
+  }
+
   if(is_signed)
   {
     PRECONDITION(width >= 1);
@@ -204,11 +204,18 @@ irep_idt irep_serializationt::read_gb_string(std::istream &in)
 
   while((c=static_cast<char>(in.get()))!=0)
   {
+    if(!in.good())
+      throw deserialization_exceptiont("unexpected end of input stream");
+
     if(length>=read_buffer.size())
       read_buffer.resize(read_buffer.size()*2, 0);
 
     if(c=='\\') // escaped chars
+    {
       read_buffer[length]=static_cast<char>(in.get());
+      if(!in.good())
+        throw deserialization_exceptiont("unexpected end of input stream");
+    }
     else
       read_buffer[length]=c;
 
@@ -183,6 +183,29 @@ const irept &merge_irept::merged(const irept &irep)
   return *entry.first;
 }
 
+void merge_irept::collect_garbage()
+{
+#ifdef SHARING
+  // Removing an irep may leave its operands referenced by the store only,
+  // hence iterate until nothing changes.
+  bool removed;
+  do
+  {
+    removed = false;
+    for(auto it = irep_store.begin(); it != irep_store.end();)
+    {
+      if(it->read().ref_count == 1)
+      {
+        it = irep_store.erase(it);
+        removed = true;
+      }
+      else
+        ++it;
+    }
+  } while(removed);
+#endif
+}
+
 void merge_full_irept::operator()(irept &irep)
 {
   // only useful if there is sharing
@@ -107,6 +107,18 @@ class merge_irept
 public:
   void operator()(irept &);
 
+  /// Number of distinct ireps currently stored
+  std::size_t size() const
+  {
+    return irep_store.size();
+  }
+
+  /// Remove all ireps that are no longer referenced from outside the store,
+  /// so that the store only holds weak references to the merged ireps.
+  /// This keeps memory bounded when merging is used on short-lived
+  /// expressions, at the cost of a pass over the store.
+  void collect_garbage();
+
 protected:
   typedef std::unordered_set<irept, irep_hash> irep_storet;
   irep_storet irep_store;
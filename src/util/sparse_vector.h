@@ -14,30 +14,77 @@ Author: Romain Brenguier
 
 #include "invariant.h"
 
+#include <bitset>
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <vector>
 
+/// A vector of which only the elements that have been accessed are stored.
+/// The elements are stored in pages of consecutive indices, such that
+/// accessing an element next to the one accessed before, as when reading or
+/// writing the elements of an object one after the other, does not need to
+/// search for its page.
 template<class T> class sparse_vectort
 {
 protected:
-  typedef std::map<uint64_t, T> underlyingt;
-  underlyingt underlying;
+  static const std::size_t page_bits = 6;
+  static const uint64_t page_size = uint64_t(1) << page_bits;
+
+  struct paget
+  {
+    paget() : elements(page_size)
+    {
+    }
+
+    std::vector<T> elements;
+    /// The elements of the page that have been accessed
+    std::bitset<page_size> present;
+  };
+
+  typedef std::map<uint64_t, paget> pagest;
+  pagest pages;
   uint64_t _size;
 
+  // the page accessed most recently
+  uint64_t last_page_no;
+  paget *last_page;
+
 public:
   sparse_vectort() :
-    _size(0) {}
+    _size(0), last_page_no(0), last_page(nullptr) {}
+
+  // the cached page pointer must not be shared between copies
+  sparse_vectort(const sparse_vectort &other)
+    : pages(other.pages),
+      _size(other._size),
+      last_page_no(0),
+      last_page(nullptr)
+  {
+  }
 
-  const T &operator[](uint64_t idx) const
+  sparse_vectort &operator=(const sparse_vectort &other)
   {
-    INVARIANT(idx<_size, "index out of range");
-    return underlying[idx];
+    pages = other.pages;
+    _size = other._size;
+    last_page = nullptr;
+    return *this;
   }
 
   T &operator[](uint64_t idx)
   {
     INVARIANT(idx<_size, "index out of range");
-    return underlying[idx];
+
+    const uint64_t page_no = idx >> page_bits;
+    if(last_page == nullptr || last_page_no != page_no)
+    {
+      last_page = &pages[page_no];
+      last_page_no = page_no;
+    }
+
+    const std::size_t offset = idx & (page_size - 1);
+    last_page->present.set(offset);
+    return last_page->elements[offset];
   }
 
   uint64_t size() const
@@ -53,20 +100,54 @@ public:
 
   void clear()
   {
-    underlying.clear();
+    pages.clear();
+    last_page = nullptr;
     _size = 0;
   }
 
-  typedef typename underlyingt::iterator iteratort;
-  typedef typename underlyingt::const_iterator const_iteratort;
-
-  iteratort begin() { return underlying.begin(); }
-  const_iteratort begin() const { return underlying.begin(); }
+  /// Call \p f with the index and the value of each element that has been
+  /// accessed, in increasing order of their indices
+  void iterate(std::function<void(uint64_t, const T &)> f) const
+  {
+    for(const auto &page : pages)
+    {
+      for(std::size_t offset = 0; offset < page_size; ++offset)
+      {
+        if(page.second.present[offset])
+          f((page.first << page_bits) + offset, page.second.elements[offset]);
+      }
+    }
+  }
 
-  iteratort end() { return underlying.end(); }
-  const_iteratort end() const { return underlying.end(); }
+  /// \return true if the element at \p idx has been accessed
+  bool is_present(uint64_t idx) const
+  {
+    const auto it = pages.find(idx >> page_bits);
+    return it != pages.end() && it->second.present[idx & (page_size - 1)];
+  }
 
-  const_iteratort find(uint64_t idx) { return underlying.find(idx); }
+  /// \return the number of elements with an index in [\p begin, \p end) that
+  ///   have been accessed
+  uint64_t count_present(uint64_t begin, uint64_t end) const
+  {
+    uint64_t count = 0;
+
+    for(auto it = pages.lower_bound(begin >> page_bits);
+        it != pages.end() && (it->first << page_bits) < end;
+        ++it)
+    {
+      const uint64_t page_begin = it->first << page_bits;
+
+      for(std::size_t offset = 0; offset < page_size; ++offset)
+      {
+        const uint64_t idx = page_begin + offset;
+        if(idx >= begin && idx < end && it->second.present[offset])
+          ++count;
+      }
+    }
+
+    return count;
+  }
 };
 
 #endif // CPROVER_UTIL_SPARSE_VECTOR_H
@@ -15,7 +15,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #include <numeric>
 
-string_ptrt::string_ptrt(const char *_s):s(_s), len(strlen(_s))
+string_ptrt::string_ptrt(const char *_s)
+  : s(_s), len(strlen(_s)), hash(hash_string(_s))
 {
 }
 
@@ -40,18 +41,7 @@ unsigned string_containert::get(const char *s)
   if(it!=hash_table.end())
     return it->second;
 
-  size_t r=hash_table.size();
-
-  // these are stable
-  string_list.push_back(std::string(s));
-  string_ptrt result(string_list.back());
-
-  hash_table[result]=r;
-
-  // these are not
-  string_vector.push_back(&string_list.back());
-
-  return r;
+  return add(string_ptr, std::string(s));
 }
 
 unsigned string_containert::get(const std::string &s)
@@ -63,49 +53,46 @@ unsigned string_containert::get(const std::string &s)
   if(it!=hash_table.end())
     return it->second;
 
-  size_t r=hash_table.size();
-
-  // these are stable
-  string_list.push_back(s);
-  string_ptrt result(string_list.back());
+  return add(string_ptr, s);
+}
 
-  hash_table[result]=r;
+unsigned string_containert::add(string_ptrt string_ptr, std::string s)
+{
+  const unsigned r = string_deque.size();
 
-  // these are not
-  string_vector.push_back(&string_list.back());
+  // this is stable; the key keeps the hash computed for the lookup
+  string_deque.push_back(std::move(s));
+  string_ptr.s = string_deque.back().c_str();
+  hash_table.emplace(string_ptr, r);
 
   return r;
 }
 
 void string_container_statisticst::dump_on_stream(std::ostream &out) const
 {
-  auto total_memory_usage = strings_memory_usage + vector_memory_usage +
-                            map_memory_usage + list_memory_usage;
+  auto total_memory_usage =
+    strings_memory_usage + deque_memory_usage + map_memory_usage;
   out << "String container statistics:"
       << "\n  string count: " << string_count
       << "\n  string memory usage: " << strings_memory_usage.to_string()
-      << "\n  vector memory usage: " << vector_memory_usage.to_string()
+      << "\n  deque memory usage:  " << deque_memory_usage.to_string()
       << "\n  map memory usage:    " << map_memory_usage.to_string()
-      << "\n  list memory usage:   " << list_memory_usage.to_string()
       << "\n  total memory usage:  " << total_memory_usage.to_string() << '\n';
 }
 
 string_container_statisticst string_containert::compute_statistics() const
 {
   string_container_statisticst result;
-  result.string_count = string_vector.size();
-  result.vector_memory_usage = memory_sizet::from_bytes(
-    sizeof(string_vector) +
-    sizeof(string_vectort::value_type) * string_vector.capacity());
+  result.string_count = string_deque.size();
+  result.deque_memory_usage = memory_sizet::from_bytes(
+    sizeof(string_deque) +
+    sizeof(string_dequet::value_type) * string_deque.size());
   result.strings_memory_usage = memory_sizet::from_bytes(std::accumulate(
-    begin(string_vector),
-    end(string_vector),
+    begin(string_deque),
+    end(string_deque),
     std::size_t(0),
-    [](std::size_t sz, const std::string *s) { return sz + s->capacity(); }));
+    [](std::size_t sz, const std::string &s) { return sz + s.capacity(); }));
   result.map_memory_usage = memory_sizet::from_bytes(
     sizeof(hash_table) + hash_table.size() * sizeof(hash_tablet::value_type));
-
-  result.list_memory_usage = memory_sizet::from_bytes(
-    sizeof(string_list) + 2 * sizeof(void *) * string_list.size());
   return result;
 }
@@ -12,9 +12,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_UTIL_STRING_CONTAINER_H
 #define CPROVER_UTIL_STRING_CONTAINER_H
 
-#include <list>
+#include <deque>
 #include <unordered_map>
-#include <vector>
 
 #include "memory_units.h"
 #include "string_hash.h"
@@ -23,6 +22,9 @@ struct string_ptrt
 {
   const char *s;
   size_t len;
+  /// Computed once on construction, such that looking up a string and then
+  /// adding it does not hash it again
+  size_t hash;
 
   const char *c_str() const
   {
@@ -31,7 +33,8 @@ struct string_ptrt
 
   explicit string_ptrt(const char *_s);
 
-  explicit string_ptrt(const std::string &_s):s(_s.c_str()), len(_s.size())
+  explicit string_ptrt(const std::string &_s)
+    : s(_s.c_str()), len(_s.size()), hash(hash_string(_s.c_str()))
   {
   }
 
@@ -42,7 +45,10 @@ struct string_ptrt
 class string_ptr_hash
 {
 public:
-  size_t operator()(const string_ptrt s) const { return hash_string(s.s); }
+  size_t operator()(const string_ptrt &s) const
+  {
+    return s.hash;
+  }
 };
 
 /// Has estimated statistics about string container
@@ -53,9 +59,8 @@ struct string_container_statisticst
 {
   std::size_t string_count;
   memory_sizet strings_memory_usage;
-  memory_sizet vector_memory_usage;
+  memory_sizet deque_memory_usage;
   memory_sizet map_memory_usage;
-  memory_sizet list_memory_usage;
 
   void dump_on_stream(std::ostream &out) const;
 };
@@ -80,13 +85,13 @@ public:
   // the pointer is guaranteed to be stable
   const char *c_str(size_t no) const
   {
-    return string_vector[no]->c_str();
+    return string_deque[no].c_str();
   }
 
   // the reference is guaranteed to be stable
   const std::string &get_string(size_t no) const
   {
-    return *string_vector[no];
+    return string_deque[no];
   }
 
   string_container_statisticst compute_statistics() const;
@@ -100,11 +105,16 @@ protected:
   unsigned get(const char *s);
   unsigned get(const std::string &s);
 
-  typedef std::list<std::string> string_listt;
-  string_listt string_list;
+  /// Store \p s and enter it into the hash table under \p string_ptr, which
+  /// has to have been constructed from a string equal to \p s
+  unsigned add(string_ptrt string_ptr, std::string s);
 
-  typedef std::vector<std::string *> string_vectort;
-  string_vectort string_vector;
+  // Appending to a deque keeps references to its elements stable, and the
+  // deque is indexed by the string number directly. The strings are stored
+  // in blocks rather than in a node each, as a list would, which avoids the
+  // per-string allocation and a separate vector of pointers to find them.
+  typedef std::deque<std::string> string_dequet;
+  string_dequet string_deque;
 };
 
 /// Get a reference to the global string container.
@@ -0,0 +1,102 @@
+/*******************************************************************\
+
+Module: Unit tests for the interval domain
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <analyses/interval_domain.h>
+
+#include <util/arith_tools.h>
+#include <util/std_types.h>
+#include <util/symbol_table.h>
+
+static constant_exprt float_constant(float value)
+{
+  ieee_floatt f(ieee_float_spect::single_precision());
+  f.from_float(value);
+  return f.to_expr();
+}
+
+SCENARIO("interval_domain_merge", "[core][analyses][interval_domain]")
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const signedbv_typet int_type(32);
+  const floatbv_typet float_type =
+    ieee_float_spect::single_precision().to_type();
+  const symbol_exprt x("x", int_type);
+  const symbol_exprt y("y", int_type);
+  const symbol_exprt f("f", float_type);
+  const symbol_exprt g("g", float_type);
+
+  GIVEN("Two domains that constrain the same and different variables")
+  {
+    interval_domaint a;
+    a.make_top();
+    a.assume(binary_relation_exprt(x, ID_le, from_integer(5, int_type)), ns);
+    a.assume(binary_relation_exprt(x, ID_ge, from_integer(0, int_type)), ns);
+    a.assume(binary_relation_exprt(y, ID_le, from_integer(1, int_type)), ns);
+    a.assume(binary_relation_exprt(f, ID_le, float_constant(1)), ns);
+    a.assume(binary_relation_exprt(g, ID_le, float_constant(3)), ns);
+
+    interval_domaint b;
+    b.make_top();
+    b.assume(binary_relation_exprt(x, ID_le, from_integer(10, int_type)), ns);
+    b.assume(binary_relation_exprt(x, ID_ge, from_integer(3, int_type)), ns);
+    b.assume(binary_relation_exprt(f, ID_le, float_constant(2)), ns);
+    b.assume(binary_relation_exprt(g, ID_le, float_constant(1)), ns);
+
+    WHEN("Merging the second into the first")
+    {
+      const interval_domaint b_before = b;
+      const bool changed = a.merge(
+        b, interval_domaint::locationt{}, interval_domaint::locationt{});
+
+      THEN("Each interval is joined with the one of the same variable")
+      {
+        REQUIRE(changed);
+        REQUIRE(
+          a.make_expression(x) ==
+          and_exprt(
+            binary_relation_exprt(x, ID_le, from_integer(10, int_type)),
+            binary_relation_exprt(from_integer(0, int_type), ID_le, x)));
+        REQUIRE(a.make_expression(y) == true_exprt());
+        REQUIRE(
+          a.make_expression(f) ==
+          binary_relation_exprt(f, ID_le, float_constant(2)));
+        REQUIRE(
+          a.make_expression(g) ==
+          binary_relation_exprt(g, ID_le, float_constant(3)));
+      }
+
+      THEN("The merged domain is unchanged")
+      {
+        REQUIRE(b.make_expression(x) == b_before.make_expression(x));
+        REQUIRE(b.make_expression(f) == b_before.make_expression(f));
+      }
+
+      THEN("Merging again does not change the result")
+      {
+        REQUIRE_FALSE(a.merge(
+          b, interval_domaint::locationt{}, interval_domaint::locationt{}));
+      }
+    }
+
+    WHEN("Merging a copy of a domain")
+    {
+      interval_domaint copy = a;
+
+      THEN("Nothing changes")
+      {
+        REQUIRE_FALSE(copy.merge(
+          a, interval_domaint::locationt{}, interval_domaint::locationt{}));
+        REQUIRE(copy.make_expression(y) == a.make_expression(y));
+      }
+    }
+  }
+}
@@ -214,6 +214,46 @@ TEST_CASE("arbitrary precision integers", "[core][big-int][bigint]")
       "09182869314710171111683916581726889419758716582152128229518488472");
   }
 
+  // =====================================================================
+  // Tests for values crossing between local and heap digit storage
+  // =====================================================================
+  SECTION("local and heap digits")
+  {
+    const BigInt small_value("12345678901234567890");
+    const BigInt large_value(
+      "123456789012345678901234567890123456789012345678901234567890");
+
+    BigInt a = small_value;
+    BigInt b = large_value;
+    a.swap(b);
+    REQUIRE(a == large_value);
+    REQUIRE(b == small_value);
+    a.swap(b);
+    REQUIRE(a == small_value);
+    REQUIRE(b == large_value);
+
+    BigInt moved(std::move(b));
+    REQUIRE(moved == large_value);
+    b = small_value;
+    REQUIRE(b == small_value);
+    b = moved;
+    REQUIRE(b == large_value);
+
+    // The product of two 64-bit values still fits into local digits.
+    BigInt product(0xFFFFFFFFFFFFFFFFull);
+    product *= BigInt(0xFFFFFFFFFFFFFFFFull);
+    REQUIRE(
+      to_string(product) == "340282366920938463426481119284349108225");
+    product *= product;
+    REQUIRE(
+      to_string(product) ==
+      "115792089237316195398462578067141184799968521174335529155"
+      "754622898352762650625");
+    product /= BigInt("340282366920938463426481119284349108225");
+    REQUIRE(
+      to_string(product) == "340282366920938463426481119284349108225");
+  }
+
   // =====================================================================
   // Tests for floorPow2
   // =====================================================================
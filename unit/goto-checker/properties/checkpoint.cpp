@@ -0,0 +1,143 @@
+/*******************************************************************\
+
+Module: Unit tests for checkpoints of property statuses
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <goto-checker/properties.h>
+
+#include <util/exception_utils.h>
+
+#include <sstream>
+
+TEST_CASE("Checkpoints of properties", "[core][goto-checker][properties]")
+{
+  goto_programt goto_program;
+  const auto pc = goto_program.add(goto_programt::make_skip());
+
+  propertiest properties;
+  properties.emplace(
+    "main.assertion.1", property_infot{pc, "a", property_statust::PASS});
+  properties.emplace(
+    "main.assertion.2", property_infot{pc, "b", property_statust::FAIL});
+  properties.emplace(
+    "main.assertion.3", property_infot{pc, "c", property_statust::UNKNOWN});
+  properties.emplace(
+    "main.assertion.4",
+    property_infot{pc, "d", property_statust::NOT_REACHABLE});
+
+  std::ostringstream out;
+  write_checkpoint(out, "1234", properties);
+
+  propertiest resumed_properties;
+  for(const auto &property_pair : properties)
+  {
+    resumed_properties.emplace(
+      property_pair.first,
+      property_infot{pc,
+                     property_pair.second.description,
+                     property_statust::NOT_CHECKED});
+  }
+
+  SECTION("Decided properties are taken over")
+  {
+    std::istringstream in(out.str());
+    REQUIRE(read_checkpoint(in, "1234", resumed_properties, true));
+
+    REQUIRE(
+      resumed_properties.at("main.assertion.1").status ==
+      property_statust::PASS);
+    REQUIRE(
+      resumed_properties.at("main.assertion.2").status ==
+      property_statust::FAIL);
+    REQUIRE(
+      resumed_properties.at("main.assertion.3").status ==
+      property_statust::NOT_CHECKED);
+    REQUIRE(
+      resumed_properties.at("main.assertion.4").status ==
+      property_statust::NOT_REACHABLE);
+  }
+
+  SECTION("Failed properties can be left to be checked again")
+  {
+    std::istringstream in(out.str());
+    REQUIRE(read_checkpoint(in, "1234", resumed_properties, false));
+
+    REQUIRE(
+      resumed_properties.at("main.assertion.1").status ==
+      property_statust::PASS);
+    REQUIRE(
+      resumed_properties.at("main.assertion.2").status ==
+      property_statust::NOT_CHECKED);
+  }
+
+  SECTION("Unknown properties are ignored")
+  {
+    std::istringstream in(
+      "CBMC checkpoint 1234\nmain.unwind.0\tSUCCESS\t\ta\n");
+    REQUIRE(read_checkpoint(in, "1234", resumed_properties, true));
+
+    REQUIRE(resumed_properties.size() == 4);
+  }
+
+  SECTION("Properties with a different description are ignored")
+  {
+    resumed_properties.at("main.assertion.1").description = "a\tb";
+
+    std::istringstream in(out.str());
+    REQUIRE(read_checkpoint(in, "1234", resumed_properties, true));
+
+    REQUIRE(
+      resumed_properties.at("main.assertion.1").status ==
+      property_statust::NOT_CHECKED);
+    REQUIRE(
+      resumed_properties.at("main.assertion.4").status ==
+      property_statust::NOT_REACHABLE);
+  }
+
+  SECTION("Descriptions with separators are taken over")
+  {
+    properties.at("main.assertion.1").description = "a\tb\\n";
+    resumed_properties.at("main.assertion.1").description = "a\tb\\n";
+
+    std::ostringstream escaped_out;
+    write_checkpoint(escaped_out, "1234", properties);
+    std::istringstream in(escaped_out.str());
+    REQUIRE(read_checkpoint(in, "1234", resumed_properties, true));
+
+    REQUIRE(
+      resumed_properties.at("main.assertion.1").status ==
+      property_statust::PASS);
+  }
+
+  SECTION("Checkpoints of a different program or options are ignored")
+  {
+    std::istringstream in(out.str());
+    REQUIRE_FALSE(read_checkpoint(in, "5678", resumed_properties, true));
+
+    REQUIRE(
+      resumed_properties.at("main.assertion.1").status ==
+      property_statust::NOT_CHECKED);
+  }
+
+  SECTION("Malformed checkpoints are rejected")
+  {
+    std::istringstream in(
+      "CBMC checkpoint 1234\nmain.assertion.1\tMAYBE\t\ta\n");
+    REQUIRE_THROWS_AS(
+      read_checkpoint(in, "1234", resumed_properties, true),
+      deserialization_exceptiont);
+  }
+
+  SECTION("Files without the header are rejected")
+  {
+    std::istringstream in("main.assertion.1\tSUCCESS\t\ta\n");
+    REQUIRE_THROWS_AS(
+      read_checkpoint(in, "1234", resumed_properties, true),
+      deserialization_exceptiont);
+  }
+}
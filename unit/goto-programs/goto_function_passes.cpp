@@ -0,0 +1,56 @@
+/*******************************************************************\
+
+Module: Unit tests for goto_function_passest
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <goto-programs/goto_function_passes.h>
+#include <goto-programs/goto_functions.h>
+
+#include <string>
+#include <vector>
+
+SCENARIO(
+  "goto_function_passes",
+  "[core][goto-programs][goto_function_passes]")
+{
+  goto_functionst goto_functions;
+  goto_functions.function_map["g"];
+  goto_functions.function_map["f"];
+
+  GIVEN("Two passes that record the functions they are applied to")
+  {
+    std::vector<std::string> applied;
+    goto_function_passest passes;
+    passes.add([&applied](const irep_idt &id, goto_functiont &goto_function) {
+      applied.push_back("first " + id2string(id));
+      goto_function.body.add(goto_programt::make_skip());
+    });
+    passes.add([&applied](const irep_idt &id, goto_functiont &goto_function) {
+      applied.push_back(
+        "second " + id2string(id) + " " +
+        std::to_string(goto_function.body.instructions.size()));
+    });
+
+    WHEN("Running them")
+    {
+      passes.run(goto_functions);
+
+      THEN("All passes are applied to one function before the next one")
+      {
+        // the functions are visited in the order of the function map
+        REQUIRE(applied.size() == 4);
+        const std::string first = applied[0] == "first f" ? "f" : "g";
+        const std::string second = first == "f" ? "g" : "f";
+        REQUIRE(applied[0] == "first " + first);
+        REQUIRE(applied[1] == "second " + first + " 1");
+        REQUIRE(applied[2] == "first " + second);
+        REQUIRE(applied[3] == "second " + second + " 1");
+      }
+    }
+  }
+}
@@ -0,0 +1,42 @@
+/*******************************************************************\
+
+Module: Unit tests for remove_skip
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <goto-programs/remove_skip.h>
+
+SCENARIO("Labels of removed skips are preserved", "[core][goto-programs]")
+{
+  GIVEN("A program with labelled skips before a labelled assignment")
+  {
+    const symbol_exprt x("x", signedbv_typet(32));
+
+    goto_programt goto_program;
+    goto_program.add(goto_programt::make_skip())->labels.push_back("a");
+    goto_program.add(goto_programt::make_skip())->labels.push_back("b");
+    auto assignment =
+      goto_program.add(goto_programt::make_assignment(x, x));
+    assignment->labels.push_back("c");
+    goto_program.add(goto_programt::make_end_function());
+
+    WHEN("Removing skips")
+    {
+      remove_skip(goto_program);
+
+      THEN("The labels move to the assignment in program order")
+      {
+        REQUIRE(goto_program.instructions.size() == 2);
+        const auto &labels = goto_program.instructions.front().labels;
+        REQUIRE(labels.size() == 3);
+        REQUIRE(labels[0] == "a");
+        REQUIRE(labels[1] == "b");
+        REQUIRE(labels[2] == "c");
+      }
+    }
+  }
+}
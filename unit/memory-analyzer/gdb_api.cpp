@@ -232,6 +232,22 @@ TEST_CASE("gdb api test", "[core][memory-analyzer]")
     }
   }
 
+  SECTION("query consecutive values")
+  {
+    const bool r = gdb_api.run_gdb_to_breakpoint("checkpoint");
+    REQUIRE(r);
+
+    const auto values = gdb_api.get_values("a[0]", 4);
+    REQUIRE(values.has_value());
+    REQUIRE(*values == std::vector<std::string>{"1", "-2", "3", "3"});
+
+    const auto tail = gdb_api.get_values("a[2]", 2);
+    REQUIRE(tail.has_value());
+    REQUIRE(*tail == std::vector<std::string>{"3", "3"});
+
+    REQUIRE_FALSE(gdb_api.get_values("undefined_symbol", 2).has_value());
+  }
+
   SECTION("query expressions")
   {
     const bool r = gdb_api.run_gdb_to_breakpoint("checkpoint");
@@ -7,6 +7,7 @@ int *p;
 void *vp;
 int *np = 0;
 void *vp_string;
+int a[4];
 
 void checkpoint()
 {
@@ -30,6 +31,11 @@ int main()
   vp = (void *)&x;
   vp_string = s;
 
+  a[0] = 1;
+  a[1] = -2;
+  a[2] = 3;
+  a[3] = 3;
+
   checkpoint();
 
   return 0;
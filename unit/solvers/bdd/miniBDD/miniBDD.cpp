@@ -350,4 +350,43 @@ SCENARIO("miniBDD", "[core][solver][miniBDD]")
       REQUIRE(oss.str() == "¬a ∨ b");
     }
   }
+
+  GIVEN("A bdd that is computed twice")
+  {
+    mini_bdd_mgrt bdd_mgr;
+    const mini_bddt x = bdd_mgr.Var("x");
+    const mini_bddt y = bdd_mgr.Var("y");
+
+    const mini_bddt first = x & y;
+    const std::size_t number_of_nodes = bdd_mgr.number_of_nodes();
+    const mini_bddt second = x & y;
+
+    THEN("The second computation yields the same node")
+    {
+      REQUIRE(second.node_number() == first.node_number());
+      REQUIRE(bdd_mgr.number_of_nodes() == number_of_nodes);
+    }
+
+    THEN("Equivalent bdds are the same node")
+    {
+      REQUIRE((first | !x).node_number() == (!x | y).node_number());
+    }
+  }
+
+  GIVEN("A bdd that is no longer referenced after it was computed")
+  {
+    mini_bdd_mgrt bdd_mgr;
+    const mini_bddt x = bdd_mgr.Var("x");
+    const mini_bddt y = bdd_mgr.Var("y");
+    const std::size_t number_of_nodes = bdd_mgr.number_of_nodes();
+
+    {
+      const mini_bddt conjunction = x & y;
+    }
+
+    THEN("The computed table keeps its node alive")
+    {
+      REQUIRE(bdd_mgr.number_of_nodes() == number_of_nodes + 1);
+    }
+  }
 }
@@ -0,0 +1,64 @@
+/*******************************************************************\
+
+Module: Unit tests for arith_tools.h
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+#include <util/arith_tools.h>
+
+TEST_CASE(
+  "converting integers to bit-vector representations",
+  "[core][util][arith_tools]")
+{
+  REQUIRE(integer2bvrep(0, 8) == "0");
+  REQUIRE(integer2bvrep(255, 8) == "FF");
+  REQUIRE(integer2bvrep(256, 8) == "0");
+  REQUIRE(integer2bvrep(-1, 8) == "FF");
+  REQUIRE(integer2bvrep(-128, 8) == "80");
+  REQUIRE(integer2bvrep(0x1234, 64) == "1234");
+  REQUIRE(integer2bvrep(-1, 64) == "FFFFFFFFFFFFFFFF");
+  REQUIRE(integer2bvrep(-1, 65) == "1FFFFFFFFFFFFFFFF");
+  REQUIRE(integer2bvrep(power(2, 64), 64) == "0");
+  REQUIRE(integer2bvrep(power(2, 64) + 5, 72) == "10000000000000005");
+}
+
+TEST_CASE(
+  "converting bit-vector representations to integers",
+  "[core][util][arith_tools]")
+{
+  REQUIRE(bvrep2integer("0", 8, true) == 0);
+  REQUIRE(bvrep2integer("7F", 8, true) == 127);
+  REQUIRE(bvrep2integer("80", 8, true) == -128);
+  REQUIRE(bvrep2integer("FF", 8, false) == 255);
+  REQUIRE(bvrep2integer("1", 1, true) == -1);
+  REQUIRE(
+    bvrep2integer("8000000000000000", 64, true) ==
+    string2integer("-9223372036854775808"));
+  REQUIRE(
+    bvrep2integer("FFFFFFFFFFFFFFFF", 64, false) ==
+    string2integer("18446744073709551615"));
+  REQUIRE(bvrep2integer("1FFFFFFFFFFFFFFFF", 65, true) == -1);
+}
+
+TEST_CASE(
+  "bit-vector representations round-trip",
+  "[core][util][arith_tools]")
+{
+  for(std::size_t width : {1, 7, 8, 31, 32, 33, 63, 64, 65, 128})
+  {
+    const mp_integer min = -power(2, width - 1);
+    const mp_integer max = power(2, width - 1) - 1;
+    for(const mp_integer &value : {min, min + 1, mp_integer(0), max - 1, max})
+    {
+      REQUIRE(bvrep2integer(integer2bvrep(value, width), width, true) == value);
+      const mp_integer unsigned_value =
+        value < 0 ? value + power(2, width) : value;
+      REQUIRE(
+        bvrep2integer(integer2bvrep(value, width), width, false) ==
+        unsigned_value);
+    }
+  }
+}
@@ -0,0 +1,74 @@
+/*******************************************************************\
+
+Module: Unit tests for merge_irep.h
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/merge_irep.h>
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+#ifdef SHARING
+
+SCENARIO("merge_irept", "[core][util][merge_irep]")
+{
+  const auto x_plus_one = [] {
+    const signedbv_typet type(32);
+    return plus_exprt(symbol_exprt("x", type), from_integer(1, type));
+  };
+
+  GIVEN("Two structurally equal expressions built independently")
+  {
+    exprt a = x_plus_one();
+    exprt b = x_plus_one();
+    REQUIRE(&a.read() != &b.read());
+
+    merge_irept merge_irep;
+    merge_irep(a);
+    merge_irep(b);
+
+    THEN("They share their representation after merging")
+    {
+      REQUIRE(&a.read() == &b.read());
+    }
+
+    THEN("Subexpressions of other expressions are shared as well")
+    {
+      exprt c = not_exprt(equal_exprt(x_plus_one(), x_plus_one()));
+      merge_irep(c);
+      const auto &equal = to_equal_expr(to_not_expr(c).op());
+      REQUIRE(&equal.lhs().read() == &a.read());
+      REQUIRE(&equal.rhs().read() == &a.read());
+    }
+
+    WHEN("Collecting garbage while the expressions are in use")
+    {
+      const std::size_t size = merge_irep.size();
+      merge_irep.collect_garbage();
+
+      THEN("Nothing is removed")
+      {
+        REQUIRE(merge_irep.size() == size);
+      }
+    }
+
+    WHEN("Collecting garbage after the expressions are gone")
+    {
+      a = exprt();
+      b = exprt();
+      merge_irep.collect_garbage();
+
+      THEN("The store is empty")
+      {
+        REQUIRE(merge_irep.size() == 0);
+      }
+    }
+  }
+}
+
+#endif
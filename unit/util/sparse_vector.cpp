@@ -0,0 +1,77 @@
+/*******************************************************************\
+
+Module: Unit tests for sparse_vectort
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/sparse_vector.h>
+
+#include <vector>
+
+TEST_CASE("sparse_vectort", "[core][util][sparse_vector]")
+{
+  sparse_vectort<int> vector;
+  vector.resize(uint64_t(1) << 33);
+  REQUIRE(vector.size() == uint64_t(1) << 33);
+
+  vector[3] = 1;
+  vector[4] = 2;
+  vector[200] = 3;
+  vector[uint64_t(1) << 32] = 4;
+
+  SECTION("Elements keep their values")
+  {
+    REQUIRE(vector[3] == 1);
+    REQUIRE(vector[4] == 2);
+    REQUIRE(vector[200] == 3);
+    REQUIRE(vector[uint64_t(1) << 32] == 4);
+  }
+
+  SECTION("Only accessed elements are present")
+  {
+    REQUIRE(vector.is_present(3));
+    REQUIRE_FALSE(vector.is_present(5));
+    REQUIRE_FALSE(vector.is_present(201));
+
+    REQUIRE(vector.count_present(0, 5) == 2);
+    REQUIRE(vector.count_present(4, 201) == 2);
+    REQUIRE(vector.count_present(5, 200) == 0);
+    REQUIRE(vector.count_present(0, uint64_t(1) << 33) == 4);
+
+    // reading an element makes it present
+    REQUIRE(vector[5] == 0);
+    REQUIRE(vector.is_present(5));
+  }
+
+  SECTION("Present elements are iterated in order")
+  {
+    std::vector<std::pair<uint64_t, int>> elements;
+    vector.iterate([&elements](uint64_t idx, const int &value) {
+      elements.emplace_back(idx, value);
+    });
+
+    REQUIRE(
+      elements == std::vector<std::pair<uint64_t, int>>{
+                    {3, 1}, {4, 2}, {200, 3}, {uint64_t(1) << 32, 4}});
+  }
+
+  SECTION("Copies are independent")
+  {
+    sparse_vectort<int> copy = vector;
+    copy[3] = 5;
+    REQUIRE(vector[3] == 1);
+    REQUIRE(copy[3] == 5);
+    REQUIRE(copy[4] == 2);
+  }
+
+  SECTION("Clearing removes all elements")
+  {
+    vector.clear();
+    REQUIRE(vector.size() == 0);
+    REQUIRE(vector.count_present(0, uint64_t(1) << 33) == 0);
+  }
+}
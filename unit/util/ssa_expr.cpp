@@ -118,6 +118,27 @@ TEST_CASE("Set expression", "[unit][util][ssa_expr]")
         REQUIRE(ssa.get_l1_object_identifier() == "sym!1@3[[9]]");
       }
     }
+
+    WHEN("call set_level_2 again")
+    {
+      ssa.set_level_2(8);
+      THEN("Only the L2 part of the identifier changes")
+      {
+        REQUIRE(ssa.get_identifier() == "sym!1@3#8");
+        REQUIRE(ssa.get_l1_object_identifier() == "sym!1@3");
+      }
+    }
+
+    WHEN("call set_level_2 again after set_expression with an index_exprt")
+    {
+      ssa.set_expression(index);
+      ssa.set_level_2(8);
+      THEN("The L2 index is placed after the symbol")
+      {
+        REQUIRE(ssa.get_identifier() == "sym!1@3#8[[9]]");
+        REQUIRE(ssa.get_l1_object_identifier() == "sym!1@3[[9]]");
+      }
+    }
   }
 }
 